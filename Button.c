@@ -8,7 +8,7 @@
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
-#include "Dio.h"
+#include "Dio_Static.h"
 #include "Button.h"
 
 /* Global variable to hold the button state */
@@ -22,7 +22,7 @@ uint8 BUTTON_getState(void)
 /*******************************************************************************************************************/
 void BUTTON_refreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 state = Dio_ReadChannelStatic(SW1);
     
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -51,4 +51,14 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to define the variables not initialized by the startup code (kept over a warm reset) */
+#if defined(__ICCARM__)
+#define NO_INIT           __no_init
+#elif defined(__GNUC__)
+/* The linker script shall place the .noinit section outside of the zeroed and copied sections */
+#define NO_INIT           __attribute__((section(".noinit")))
+#else
+#define NO_INIT
+#endif
+
 #endif
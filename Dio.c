@@ -27,6 +27,12 @@
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* The used ports shall be described in Gpio_Ports.c */
+typedef char Dio_NumberOfPortsCheck[(DIO_NUMBER_OF_PORTS <= GPIO_NUMBER_OF_PORTS) ? 1 : -1];
+
+/* Data register address and pin mask of each configured channel, resolved once by Dio_Init */
+STATIC Dio_ChannelAccessType Dio_ChannelAccess[DIO_CONFIGURED_CHANNLES];
+
 /************************************************************************************
 * Service Name: Dio_Init
 * Service ID[hex]: 0x10
@@ -40,9 +46,35 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+	Dio_ChannelType Channel;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
+	boolean error = FALSE;
+
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
+	{
+		error = TRUE;
+	}
+	else
+	{
+		/* check if every channel is a pin of a port described in Gpio_Ports.c (post-build data) */
+		for(Channel = 0; Channel < DIO_CONFIGURED_CHANNLES; Channel++)
+		{
+			if ((ConfigPtr->Channels[Channel].Port_Num >= GPIO_NUMBER_OF_PORTS) ||
+			    (ConfigPtr->Channels[Channel].Ch_Num >= 8U) ||
+			    ((Gpio_PortDescriptors[ConfigPtr->Channels[Channel].Port_Num].Pins & (1U << ConfigPtr->Channels[Channel].Ch_Num)) == 0))
+			{
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+
+	if (TRUE == error)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_INIT_SID,
 		     DIO_E_PARAM_CONFIG);
@@ -51,11 +83,32 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 #endif
 	{
 		/*
-		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
+		 * Point to the PB configuration structure using a global pointer.
 		 * This global pointer is global to be used by other functions to read the PB configuration structures
 		 */
-		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		/*
+		 * Resolve the channel access address (masked aperture or bit-band alias) and the pin mask of every configured channel once,
+		 * so the channel APIs only need a table lookup instead of a port switch and a variable shift
+		 */
+		for(Channel = 0; Channel < DIO_CONFIGURED_CHANNLES; Channel++)
+		{
+			Dio_ChannelAccess[Channel].Mask = (uint8)(1U << Dio_PortChannels[Channel].Ch_Num);
+
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+			/* Point to the bit-band alias word of this channel bit in the data register */
+			Dio_ChannelAccess[Channel].Data_Reg =
+				DIO_BIT_BAND_ALIAS_ADDRESS(DIO_BASE_ADDRESS(Dio_PortChannels[Channel].Port_Num), Dio_PortChannels[Channel].Ch_Num);
+#else
+			/* Point to the data register aperture that only exposes this channel bit */
+			Dio_ChannelAccess[Channel].Data_Reg =
+				DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(Dio_PortChannels[Channel].Port_Num), Dio_ChannelAccess[Channel].Mask);
+#endif
+		}
+
+		/* Set the module state to initialized only after the channel table is ready */
+		Dio_Status = DIO_INITIALIZED;
 	}
 }
 
@@ -73,7 +126,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 ************************************************************************************/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelAccessType * Channel_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,31 +158,23 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* Get the data register and the pin mask resolved by Dio_Init for this channel */
+		Channel_Ptr = &Dio_ChannelAccess[ChannelId];
+
+		/*
+		 * The channel address only exposes this channel bit (masked aperture or bit-band alias), so the level
+		 * is written with a single store and no read-modify-write (safe against ISRs using other pins of the port).
+		 * Writing all ones sets the channel bit through both: the aperture masks it and the alias uses bit 0.
+		 */
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*(Channel_Ptr->Data_Reg) = DIO_DATA_ALL_PINS_MASK;
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*(Channel_Ptr->Data_Reg) = 0;
 		}
 	}
 	else
@@ -152,7 +197,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 ************************************************************************************/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelAccessType * Channel_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +230,11 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
+		/* Get the data register and the pin mask resolved by Dio_Init for this channel */
+		Channel_Ptr = &Dio_ChannelAccess[ChannelId];
+
+		/* Read the required channel ... all the other bits of the port read as 0 through the channel address */
+		if(*(Channel_Ptr->Data_Reg) != 0)
 		{
 			output = STD_HIGH;
 		}
@@ -218,6 +250,289 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
         return output;
 }
 
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the pins of the port with a single access through the full data register aperture */
+		output = (Dio_PortLevelType)(*DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(PortId), DIO_DATA_ALL_PINS_MASK));
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a value of the port.
+************************************************************************************/
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write all the pins of the port with a single store through the full data register aperture */
+		*DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(PortId), DIO_DATA_ALL_PINS_MASK) = Level;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_MaskedWritePort
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
+*                  Mask - Channels to be written (bit = 1 --> channel is written).
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the value of the masked channels of the port,
+*              the channels outside the mask keep their levels.
+************************************************************************************/
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* The mask is applied by the address bits, so only the masked pins change with a single store */
+		*DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(PortId), Mask) = Level;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port,
+*              the value is shifted to the LSB according to the group offset.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the channel group is valid and belongs to a valid port */
+	if ((NULL_PTR == ChannelGroupIdPtr) || (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read only the group pins with a single load, the other pins read as 0 through the masked address */
+		output = (Dio_PortLevelType)(*DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(ChannelGroupIdPtr->PortIndex),
+		                                                      ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+        return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to a specified level,
+*              the value is shifted to the group position according to the group offset.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the channel group is valid and belongs to a valid port */
+	if ((NULL_PTR == ChannelGroupIdPtr) || (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex))
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/*
+		 * The group mask is applied by the address bits, so all the group pins change together
+		 * with a single store and the other pins of the port are not touched (no glitches)
+		 */
+		*DIO_DATA_MASKED_ADDRESS(DIO_BASE_ADDRESS(ChannelGroupIdPtr->PortIndex),
+		                         ChannelGroupIdPtr->mask) = ((uint32)Level << ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -271,8 +586,9 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
+	const Dio_ChannelAccessType * Channel_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
+	uint32 Old_Level = 0;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -304,33 +620,17 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-                    case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-                    case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-                    case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel and write the required level */
-		if(BIT_IS_SET(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num))
-		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
-		}
-		else
-		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_HIGH;
-		}
+		/* Get the data register and the pin mask resolved by Dio_Init for this channel */
+		Channel_Ptr = &Dio_ChannelAccess[ChannelId];
+
+		/*
+		 * The channel address only exposes this channel bit, so the level is read back from the pin with one load
+		 * and the opposite level is written with one store of the inverted value (bit 0 through the bit-band alias).
+		 * The other pins of the port are neither read nor written, so ISR updates on them can't be lost.
+		 */
+		Old_Level = *(Channel_Ptr->Data_Reg);
+		*(Channel_Ptr->Data_Reg) = ~Old_Level;
+		output = (Old_Level != 0) ? STD_LOW : STD_HIGH;
 	}
 	else
 	{
@@ -102,6 +102,9 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -163,26 +166,47 @@ typedef struct
 	Dio_ChannelType Ch_Num;
 }Dio_ConfigChannel;
 
+/* Structure holding the register access information of a channel resolved by Dio_Init */
+typedef struct
+{
+	/* Address used to access this channel only: the masked data register aperture or the bit-band alias word */
+	volatile uint32 * Data_Reg;
+	/* Mask of the channel bit inside the data register */
+	uint8 Mask;
+}Dio_ChannelAccessType;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
+#endif
+
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
 /* Function for DIO Initialization API */
@@ -35,6 +35,27 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/* Pre-compile option for presence of Dio_MaskedWritePort API */
+#define DIO_MASKED_WRITE_PORT_API           (STD_ON)
+
+/*
+ * Pre-compile option for the channel access backend:
+ * STD_OFF --> channels are accessed through the GPIODATA address-mask aperture
+ * STD_ON  --> channels are accessed through the Cortex-M4 peripheral bit-band alias region
+ */
+#define DIO_BIT_BAND_ACCESS                 (STD_OFF)
+
+/*
+ * Pre-compile option for the GPIO aperture used by the Dio Driver:
+ * STD_OFF --> legacy APB aperture, STD_ON --> AHB aperture.
+ * It shall match PORT_AHB_APERTURE in Port_Cfg.h as Port_Init selects the aperture in GPIOHBCTL
+ * (checked in Gpio_Ports.c).
+ */
+#define DIO_AHB_APERTURE                    (STD_OFF)
+
+/* Number of the GPIO Ports (PORTA --> PORTF), the Port ID is the index of the port */
+#define DIO_NUMBER_OF_PORTS                  (6U)
+
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
@@ -50,4 +71,18 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_NIBBLE_BUS_GROUP_ID_INDEX    (uint8)0x00
+
+/* DIO Configured Channel Groups (PB4 --> PB7 parallel nibble bus) */
+#define DioConf_NIBBLE_BUS_GROUP_MASK        (uint8)0xF0
+#define DioConf_NIBBLE_BUS_GROUP_OFFSET      (uint8)4
+#define DioConf_NIBBLE_BUS_GROUP_PORT_NUM    (Dio_PortType)1 /* PORTB */
+
+/* Symbolic name of the Channel Group to be used with the Channel Group APIs */
+#define DioConf_NIBBLE_BUS_GROUP_PTR         (&Dio_Configuration.Groups[DioConf_NIBBLE_BUS_GROUP_ID_INDEX])
+
 #endif /* DIO_CFG_H */
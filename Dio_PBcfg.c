@@ -5,6 +5,7 @@
  * File Name: Dio_PBcfg.c
  *
  * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Dio Driver
+ *              Generated by Tools/Port_Generator from the pin description file ... do not edit.
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
@@ -39,8 +40,20 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* The described channels and groups shall match the Pre-Compile configuration in Dio_Cfg.h */
+typedef char Dio_ChannelsCountCheck[(DIO_CONFIGURED_CHANNLES == 2U) ? 1 : -1];
+typedef char Dio_GroupsCountCheck[(DIO_CONFIGURED_GROUPS == 1U) ? 1 : -1];
+typedef char Dio_LED1_Check[((DioConf_LED1_CHANNEL_ID_INDEX == 0) && (DioConf_LED1_PORT_NUM == 5) && (DioConf_LED1_CHANNEL_NUM == 1)) ? 1 : -1];
+typedef char Dio_SW1_Check[((DioConf_SW1_CHANNEL_ID_INDEX == 1) && (DioConf_SW1_PORT_NUM == 5) && (DioConf_SW1_CHANNEL_NUM == 4)) ? 1 : -1];
+typedef char Dio_NIBBLE_BUS_Check[((DioConf_NIBBLE_BUS_GROUP_ID_INDEX == 0) && (DioConf_NIBBLE_BUS_GROUP_PORT_NUM == 1) && (DioConf_NIBBLE_BUS_GROUP_MASK == 0xF0) && (DioConf_NIBBLE_BUS_GROUP_OFFSET == 4)) ? 1 : -1];
+
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
-				         };
\ No newline at end of file
+                                             {
+                                              {DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM},
+                                              {DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM}
+                                             },
+                                             {
+                                              {DioConf_NIBBLE_BUS_GROUP_MASK,DioConf_NIBBLE_BUS_GROUP_OFFSET,DioConf_NIBBLE_BUS_GROUP_PORT_NUM}
+                                             }
+                                         };
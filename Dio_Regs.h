@@ -13,12 +13,63 @@
 #define DIO_REGS_H
 
 #include "Std_Types.h"
+#include "Dio_Cfg.h"
+#include "Gpio_Ports.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+#if (DIO_AHB_APERTURE == STD_ON)
+
+/* GPIO Ports base addresses on the Advanced High-performance Bus (AHB) aperture */
+#define DIO_PORTA_BASE_ADDRESS    0x40058000
+#define DIO_PORTB_BASE_ADDRESS    0x40059000
+#define DIO_PORTC_BASE_ADDRESS    0x4005A000
+#define DIO_PORTD_BASE_ADDRESS    0x4005B000
+#define DIO_PORTE_BASE_ADDRESS    0x4005C000
+#define DIO_PORTF_BASE_ADDRESS    0x4005D000
+
+/* Base address of a GPIO Port from its Port ID as a constant expression for Dio_Static.h (the AHB apertures are contiguous) */
+#define DIO_PORT_BASE_ADDRESS(PORT_NUM)   (DIO_PORTA_BASE_ADDRESS + ((uint32)(PORT_NUM) * 0x1000U))
+
+#else
+
+/* GPIO Ports base addresses on the Advanced Peripheral Bus (APB) aperture */
+#define DIO_PORTA_BASE_ADDRESS    0x40004000
+#define DIO_PORTB_BASE_ADDRESS    0x40005000
+#define DIO_PORTC_BASE_ADDRESS    0x40006000
+#define DIO_PORTD_BASE_ADDRESS    0x40007000
+#define DIO_PORTE_BASE_ADDRESS    0x40024000
+#define DIO_PORTF_BASE_ADDRESS    0x40025000
+
+/* Base address of a GPIO Port from its Port ID as a constant expression for Dio_Static.h (PORTA --> PORTD then PORTE --> PORTF) */
+#define DIO_PORT_BASE_ADDRESS(PORT_NUM)   (((PORT_NUM) < 4U) ? (DIO_PORTA_BASE_ADDRESS + ((uint32)(PORT_NUM) * 0x1000U))\
+                                                             : (DIO_PORTE_BASE_ADDRESS + ((uint32)((PORT_NUM) - 4U) * 0x1000U)))
+
+#endif
+
+/* Registers base address of a GPIO Port on the selected aperture, from the GPIO Ports description (used at run time) */
+#if (DIO_AHB_APERTURE == STD_ON)
+#define DIO_BASE_ADDRESS(PORT_NUM)        (Gpio_PortDescriptors[(PORT_NUM)].Ahb_Base_Address)
+#else
+#define DIO_BASE_ADDRESS(PORT_NUM)        (Gpio_PortDescriptors[(PORT_NUM)].Apb_Base_Address)
+#endif
+
+/*
+ * GPIODATA is mapped over offsets 0x000 - 0x3FC, address bits [9:2] act as a mask:
+ * a read returns only the masked bits (others read as 0) and a write changes only the masked bits.
+ * So a pin can be written with a single store without reading the register first.
+ */
+#define DIO_DATA_ALL_PINS_MASK    0xFF
+#define DIO_DATA_MASKED_ADDRESS(BASE,MASK)  ((volatile uint32 *)((uint32)(BASE) + ((uint32)(MASK) << 2)))
+
+/*
+ * Cortex-M4 peripheral bit-band region: each bit of the peripheral region (0x40000000 - 0x400FFFFF)
+ * is mapped to a word in the alias region (0x42000000 - 0x43FFFFFF), bit 0 of the alias word
+ * reads/writes the mapped bit atomically.
+ */
+#define DIO_DATA_REG_OFFSET                   0x3FC
+#define DIO_PERIPHERAL_BASE_ADDRESS           0x40000000
+#define DIO_BIT_BAND_ALIAS_BASE_ADDRESS       0x42000000
+#define DIO_BIT_BAND_ALIAS_ADDRESS(BASE,BIT)  ((volatile uint32 *)(DIO_BIT_BAND_ALIAS_BASE_ADDRESS\
+                                              + (((uint32)(BASE) + DIO_DATA_REG_OFFSET - DIO_PERIPHERAL_BASE_ADDRESS) << 5)\
+                                              + ((uint32)(BIT) << 2)))
 
 #endif /* DIO_REGS_H */
@@ -0,0 +1,94 @@
+ /******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Static.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Dio Driver
+ *              compile-time accessors for the statically configured channels.
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#ifndef DIO_STATIC_H
+#define DIO_STATIC_H
+
+#include "Dio.h"
+#include "Dio_Regs.h"
+
+/*
+ * The accessors below take the symbolic channel name used in Dio_Cfg.h (LED1 for DioConf_LED1_xxx).
+ * The masked data register address is resolved at compile time, so each access is a single load or store
+ * without the table lookup and the DET checks of Dio_ReadChannel/Dio_WriteChannel/Dio_FlipChannel.
+ * An unknown channel name or a channel with an invalid port/pin number fails the compilation.
+ */
+
+/* Compile-time check ... the array size is negative when COND is false */
+#define DIO_STATIC_CHECK(COND)            ((void)sizeof(char[(COND) ? 1 : -1]))
+
+/* Check the configured port and pin numbers of the channel */
+#define DIO_STATIC_CHANNEL_CHECK(NAME)    (DIO_STATIC_CHECK((DioConf_##NAME##_CHANNEL_ID_INDEX < DIO_CONFIGURED_CHANNLES)\
+                                                         && (DioConf_##NAME##_PORT_NUM < DIO_NUMBER_OF_PORTS)\
+                                                         && (DioConf_##NAME##_CHANNEL_NUM < 8U)))
+
+/* Mask of the channel bit inside the data register */
+#define DIO_STATIC_CHANNEL_MASK(NAME)     ((uint8)(1U << DioConf_##NAME##_CHANNEL_NUM))
+
+/* Data register aperture that only exposes the channel bit */
+#define DIO_STATIC_CHANNEL_ADDRESS(NAME)  DIO_DATA_MASKED_ADDRESS(DIO_PORT_BASE_ADDRESS(DioConf_##NAME##_PORT_NUM),\
+                                                                  DIO_STATIC_CHANNEL_MASK(NAME))
+
+/*******************************************************************************
+ *                      Static Accessors                                       *
+ *******************************************************************************/
+
+/* Write the level of a statically known channel with a single store */
+#define Dio_WriteChannelStatic(NAME, LEVEL)  (DIO_STATIC_CHANNEL_CHECK(NAME),\
+                                              Dio_StaticWrite(DIO_STATIC_CHANNEL_ADDRESS(NAME), DIO_STATIC_CHANNEL_MASK(NAME), (LEVEL)))
+
+/* Read the level of a statically known channel with a single load */
+#define Dio_ReadChannelStatic(NAME)          (DIO_STATIC_CHANNEL_CHECK(NAME),\
+                                              Dio_StaticRead(DIO_STATIC_CHANNEL_ADDRESS(NAME)))
+
+/* Flip the level of a statically known channel and return the level after flip */
+#define Dio_FlipChannelStatic(NAME)          (DIO_STATIC_CHANNEL_CHECK(NAME),\
+                                              Dio_StaticFlip(DIO_STATIC_CHANNEL_ADDRESS(NAME)))
+
+/*******************************************************************************
+ *                      Inline Helpers                                         *
+ *******************************************************************************/
+
+/* Description: Write Logic High/Low through the masked data register address */
+LOCAL_INLINE void Dio_StaticWrite(volatile uint32 * Data_Reg, uint8 Mask, Dio_LevelType Level)
+{
+	if(Level == STD_HIGH)
+	{
+		*Data_Reg = Mask;
+	}
+	else if(Level == STD_LOW)
+	{
+		*Data_Reg = 0;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/* Description: Read the channel level through the masked data register address (the other bits read as 0) */
+LOCAL_INLINE Dio_LevelType Dio_StaticRead(volatile uint32 * Data_Reg)
+{
+	return (*Data_Reg != 0) ? STD_HIGH : STD_LOW;
+}
+
+/* Description: Flip the channel level through the masked data register address, like Dio_FlipChannel:
+ *              one load of the channel bit and one store of the inverted value (the other bits are masked) */
+LOCAL_INLINE Dio_LevelType Dio_StaticFlip(volatile uint32 * Data_Reg)
+{
+	uint32 Old_Level = *Data_Reg;
+
+	*Data_Reg = ~Old_Level;
+	return (Old_Level != 0) ? STD_LOW : STD_HIGH;
+}
+
+#endif /* DIO_STATIC_H */
@@ -0,0 +1,44 @@
+ /******************************************************************************
+ *
+ * Module: Gpio Ports
+ *
+ * File Name: Gpio_Ports.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - description of the
+ *              GPIO Ports shared by the Port and Dio Drivers.
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#include "Gpio_Ports.h"
+#include "Dio_Cfg.h"
+#include "Port_Cfg.h"
+
+/* Port_Init selects the aperture of the ports in GPIOHBCTL, the Dio Driver shall access the same aperture */
+#if (DIO_AHB_APERTURE != PORT_AHB_APERTURE)
+#error "DIO_AHB_APERTURE in Dio_Cfg.h does not match PORT_AHB_APERTURE in Port_Cfg.h"
+#endif
+
+/*
+ * From the TM4C123GH6PM datasheet:
+ * - PC0 --> PC3 are the JTAG pins
+ * - PD7 and PF0 are locked after reset (GPIOLOCK/GPIOCR)
+ * - The pins supporting each mode come from the GPIO pins and alternate functions table,
+ *   the mode index is the GPIOPCTL encoding: DIO, ALT1 --> ALT9, ALT14 and ADC (analog AINx pins)
+ */
+const Gpio_PortDescriptorType Gpio_PortDescriptors[GPIO_NUMBER_OF_PORTS] = {
+  /*   APB    ,    AHB    , SYSCTL, PINS, COMMIT, JTAG */
+  /*  { DIO , ALT1, ALT2, ALT3, ALT4, ALT5, ALT6, ALT7, ALT8, ALT9,  10 ,  11 ,  12 ,  13 ,ALT14, ADC  } */
+  { 0x40004000, 0x40058000, 0x01 , 0xFF, 0x00 , 0x00,
+      { 0xFF, 0x03, 0x3C, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, /* PORTA */
+  { 0x40005000, 0x40059000, 0x02 , 0xFF, 0x00 , 0x00,
+      { 0xFF, 0x03, 0xF0, 0x0C, 0xF0, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30 } }, /* PORTB */
+  { 0x40006000, 0x4005A000, 0x04 , 0xFF, 0x00 , 0x0F,
+      { 0xFF, 0xFF, 0x30, 0x00, 0x30, 0x00, 0x70, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } }, /* PORTC */
+  { 0x40007000, 0x4005B000, 0x08 , 0xFF, 0x80 , 0x00,
+      { 0xFF, 0xFF, 0x0F, 0x03, 0x47, 0x03, 0xC8, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F } }, /* PORTD */
+  { 0x40024000, 0x4005C000, 0x10 , 0x3F, 0x00 , 0x00,
+      { 0x3F, 0x33, 0x00, 0x30, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F } }, /* PORTE */
+  { 0x40025000, 0x4005D000, 0x20 , 0x1F, 0x01 , 0x00,
+      { 0x1F, 0x03, 0x0F, 0x09, 0x14, 0x0F, 0x13, 0x1F, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00 } }  /* PORTF */
+};
@@ -0,0 +1,44 @@
+ /******************************************************************************
+ *
+ * Module: Gpio Ports
+ *
+ * File Name: Gpio_Ports.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - description of the
+ *              GPIO Ports shared by the Port and Dio Drivers.
+ *
+ *              Each port is described once (base addresses, system control bit,
+ *              locked pins, JTAG pins and pins supporting each mode), so the drivers
+ *              index the table by the port number instead of testing port numbers.
+ *              Another part of the family only needs another table.
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#ifndef GPIO_PORTS_H
+#define GPIO_PORTS_H
+
+#include "Std_Types.h"
+
+/* Number of GPIO Ports of TM4C123GH6PM (PORTA --> PORTF) */
+#define GPIO_NUMBER_OF_PORTS          (6U)
+
+/* Number of the pin modes described per port (GPIOPCTL encoding: DIO, ALT1 --> ALT14 and ADC) */
+#define GPIO_NUMBER_OF_MODES          (16U)
+
+/* Description: Description of one GPIO Port */
+typedef struct
+{
+    uint32 Apb_Base_Address;                 /* Registers base address on the APB aperture */
+    uint32 Ahb_Base_Address;                 /* Registers base address on the AHB aperture */
+    uint32 Sysctl_Mask;                      /* Bit of the port in the RCGC2, PRGPIO and GPIOHBCTL registers */
+    uint8  Pins;                             /* Pins available on the package */
+    uint8  Commit_Pins;                      /* Locked pins that need the GPIOCR register to be committed */
+    uint8  Jtag_Pins;                        /* Pins reserved for JTAG, never configured by the drivers */
+    uint8  Mode_Pins[GPIO_NUMBER_OF_MODES];  /* Pins supporting each mode (bit n = 1 --> pin n supports the mode) */
+}Gpio_PortDescriptorType;
+
+/* Description of each GPIO Port, indexed by the port number */
+extern const Gpio_PortDescriptorType Gpio_PortDescriptors[GPIO_NUMBER_OF_PORTS];
+
+#endif /* GPIO_PORTS_H */
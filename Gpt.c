@@ -15,11 +15,17 @@
 #define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY  3
 #define SYSTICK_PRIORITY_BITS_POS   29
+#define SYSTICK_MAX_RELOAD          0x00FFFFFF   /* 24-bit Reload value */
+#define SYSTICK_PENDSTSET_MASK      0x04000000   /* SysTick Interrupt pending bit in the INTCTRL Register */
+#define SYSTICK_RELOAD_MARGIN       64           /* Clocks needed before the end of the count to write the Reload value */
 
 /* Global pointer to function used to point upper layer functions
  * to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/* Reload value of the period set by SysTick_Start */
+static uint32 g_SysTick_Reload = 0;
+
 /************************************************************************************
 * Service Name: SysTick_Handler
 * Description: SysTick Timer ISR
@@ -50,7 +56,8 @@ void SysTick_Handler(void)
 void SysTick_Start(uint16 Tick_Time)
 {
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
+    g_SysTick_Reload    = (16000 * Tick_Time) - 1;   /* The count lasts Reload + 1 clocks */
+    SYSTICK_RELOAD_REG  = g_SysTick_Reload;          /* Set the Reload value to count n miliseconds */
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
@@ -89,4 +96,50 @@ void SysTick_Stop(void)
 void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
     g_SysTick_Call_Back_Ptr = Ptr2Func;
-}
\ No newline at end of file
+}
+/************************************************************************************
+* Service Name: SysTick_SetNextPeriod
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): Periods - Length of the next count in periods of SysTick_Start
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when the next count lasts Periods periods
+* Description: Function to set the length of the count following the current one:
+*              - The Reload value is loaded by the hardware at the end of the current count, the timer
+*                is never stopped and the Current value is never written, so no clock of the time base is lost
+*              - Nothing is changed when the current count already ended (interrupt pending), ends within
+*                SYSTICK_RELOAD_MARGIN clocks, or when the Reload value exceeds 24 bits
+*              Called with the interrupts disabled, or from the SysTick ISR at the start of a count.
+************************************************************************************/
+boolean SysTick_SetNextPeriod(uint16 Periods)
+{
+    boolean Programmed = FALSE;
+
+    if((Periods != 0) && (((SYSTICK_MAX_RELOAD + 1) / (g_SysTick_Reload + 1)) >= Periods) &&
+       ((NVIC_INT_CTRL_REG & SYSTICK_PENDSTSET_MASK) == 0) && (SYSTICK_CURRENT_REG >= SYSTICK_RELOAD_MARGIN))
+    {
+        SYSTICK_RELOAD_REG = (Periods * (g_SysTick_Reload + 1)) - 1;
+        Programmed = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return Programmed;
+}
+
+/************************************************************************************
+* Service Name: SysTick_GetPeriodCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Clock cycles of one period
+* Description: Function to return the number of system clock cycles of the period set by SysTick_Start.
+************************************************************************************/
+uint32 SysTick_GetPeriodCycles(void)
+{
+    return g_SysTick_Reload + 1;
+}
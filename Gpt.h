@@ -57,4 +57,29 @@ void SysTick_Stop(void);
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: SysTick_SetNextPeriod
+* Sync/Async: Synchronous
+* Reentrancy: non reentrant
+* Parameters (in): Periods - Length of the next count in periods of SysTick_Start
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE when the next count lasts Periods periods
+* Description: Function to set the length of the count following the current one, without stopping
+*              the timer. Refused when the current count ends too soon or the Reload value exceeds 24 bits.
+************************************************************************************/
+boolean SysTick_SetNextPeriod(uint16 Periods);
+
+/************************************************************************************
+* Service Name: SysTick_GetPeriodCycles
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Clock cycles of one period
+* Description: Function to return the number of system clock cycles of the period set by SysTick_Start.
+************************************************************************************/
+uint32 SysTick_GetPeriodCycles(void);
+
 #endif /* GPT_H */
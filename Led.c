@@ -8,31 +8,31 @@
  *
  * Author: Mohamed Tarek
  ******************************************************************************/
-#include "Dio.h"
+#include "Dio_Static.h"
 #include "Led.h"
 
 void LED_setOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    Dio_WriteChannelStatic(LED1,LED_ON);  /* LED ON */
 }
 
 /*********************************************************************************************/
 void LED_setOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    Dio_WriteChannelStatic(LED1,LED_OFF); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void LED_refreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    Dio_LevelType state = Dio_ReadChannelStatic(LED1);
+    Dio_WriteChannelStatic(LED1,state); /* re-write the same value */
 }
 
 /*********************************************************************************************/
 void LED_toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Dio_LevelType state = Dio_FlipChannelStatic(LED1);
 }
 
 /*********************************************************************************************/
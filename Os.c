@@ -13,17 +13,496 @@
 #include "App.h"
 #include "Gpt.h"
 
+#if (OS_TASK_PROFILING == STD_ON) || (OS_CPU_LOAD_API == STD_ON)
+#include "tm4c123gh6pm_registers.h"
+
+/* Cycle source of the task profiling and the CPU load, a host build can define its own virtual cycle counter */
+#ifndef OS_PROFILE_CYCLE_COUNT
+#define OS_PROFILE_CYCLE_COUNT()   (DWT_CYCCNT_REG)
+#define OS_DWT_CYCLE_COUNTER       /* The DWT unit is only enabled when it is the cycle source */
+#endif
+
+#define OS_DEMCR_TRCENA            (0x01000000UL)   /* Enable the DWT unit */
+#define OS_DWT_CYCCNTENA           (0x00000001UL)   /* Enable the cycle counter */
+#endif
+
+/* The core instructions below can be replaced by a host build (simulated interrupts and sleep) */
+#ifndef Enable_Interrupts
 /* Enable IRQ Interrupts ... This Macro enables IRQ interrupts by clearing the I-bit in the PRIMASK. */
 #define Enable_Interrupts()    __asm("CPSIE I")
+#endif
 
+#ifndef Disable_Interrupts
 /* Disable IRQ Interrupts ... This Macro disables IRQ interrupts by setting the I-bit in the PRIMASK. */
 #define Disable_Interrupts()   __asm("CPSID I")
+#endif
+
+#ifndef Wait_For_Interrupt
+/* Wait For Interrupt ... This Macro sleeps until an interrupt is pending, even when the PRIMASK masks it. */
+#define Wait_For_Interrupt()   __asm("WFI")
+#endif
+
+#if (OS_TICKLESS == STD_ON) && (OS_IDLE_WFI == STD_OFF)
+#error "OS_TICKLESS needs OS_IDLE_WFI"
+#endif
+
+/* The tickless step and the tick count are 32-bit, the SysTick takes a 16-bit number of periods */
+typedef char Os_TicklessMaxTicksCheck[((OS_TICKLESS_MAX_TICKS >= 1U) && (OS_TICKLESS_MAX_TICKS <= 0xFFFFU)) ? 1 : -1];
+
+/* Global variable store the Os Time in ticks */
+static volatile uint32 g_Time_Tick_Count = 0;
+
+/* Next release tick of each task, the release ticks wrap with the tick counter */
+static uint32 g_Task_Next_Release[OS_NUMBER_OF_TASKS];
+
+/* Indexes of the tasks in the Os_Tasks table sorted from the highest priority, the tasks with a period are first */
+static uint8 g_Task_Dispatch_Order[OS_NUMBER_OF_TASKS];
+static uint8 g_Task_Dispatch_Count = 0;
+
+/* Tick count already handled by the scheduler, g_Time_Tick_Count - g_Scheduler_Tick ticks are pending */
+static uint32 g_Scheduler_Tick = 0;
+
+#if (OS_TICKLESS == STD_ON)
+/*
+ * Ticks of the running SysTick count (added by its interrupt) and of the count programmed after it.
+ * The SysTick loads a new length at the end of a count only, the lengths follow it through this pipeline.
+ */
+static volatile uint32 g_Tick_Step = 1;
+static volatile uint32 g_Next_Step = 1;
+#endif
+
+#if (OS_STATISTICS_API == STD_ON)
+/* Timing statistics of each task */
+static Os_TaskStatsType g_Task_Stats[OS_NUMBER_OF_TASKS];
+
+/* Ticks merged into a later tick because the scheduler was still busy */
+static uint32 g_Lost_Ticks = 0;
+
+#if (OS_TICKLESS == STD_ON)
+/* Timer interrupts and the interrupts already handled by the scheduler, an interrupt can add many ticks */
+static volatile uint32 g_Timer_Interrupts = 0;
+static uint32 g_Scheduler_Interrupts = 0;
+#endif
+
+#if (OS_IDLE_WFI == STD_ON)
+/* Returns from WFI in the idle of the scheduler */
+static uint32 g_Idle_Wakeups = 0;
+#endif
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/* Execution time profile of each task */
+static Os_TaskProfileType g_Task_Profile[OS_NUMBER_OF_TASKS];
+#endif
+
+/* Ticks of the hyperperiod of the tasks (limited to OS_MAX_HYPERPERIOD_TICKS) */
+static uint32 g_Hyperperiod = 1;
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/* The hyperperiod window is kept inside the long window */
+typedef char Os_CpuLoadWindowCheck[(OS_MAX_HYPERPERIOD_TICKS <= OS_CPU_LOAD_LONG_WINDOW_TICKS) ? 1 : -1];
+
+/* Description: Rolling load windows of one measurement source, the load of each tick is kept in permille */
+typedef struct
+{
+    uint16 Ring[OS_CPU_LOAD_LONG_WINDOW_TICKS];
+    uint32 Hyperperiod_Sum;
+    uint32 Long_Sum;
+    uint16 Tick_Load;
+}Os_LoadWindowType;
+
+/* Measured sources: the idle loop is replaced by WFI with OS_IDLE_WFI, only the DWT source (index 0) is kept */
+#if (OS_IDLE_WFI == STD_ON)
+#define OS_CPU_LOAD_MEASURED_SOURCES   (1U)
+typedef char Os_CpuLoadDwtCheck[(OS_CPU_LOAD_DWT == 0U) ? 1 : -1];
+#else
+#define OS_CPU_LOAD_MEASURED_SOURCES   (OS_CPU_LOAD_SOURCES)
+#endif
+
+static Os_LoadWindowType g_Load_Window[OS_CPU_LOAD_MEASURED_SOURCES];
+
+/* Next slot of the load rings and the number of filled slots */
+static uint32 g_Load_Index = 0;
+static uint32 g_Load_Ticks = 0;
+
+#if (OS_IDLE_WFI == STD_OFF)
+/* Idle loop iterations since the last tick and iterations of a fully idle tick (calibrated by Os_start) */
+static uint32 g_Idle_Loops = 0;
+static uint32 g_Idle_Loops_Per_Tick = 1;
+#endif
+
+/* Cycle count at the start of the current scheduling window and the busy cycles of the window */
+static uint32 g_Window_Start_Cycles = 0;
+static uint32 g_Busy_Cycles = 0;
+#endif
+
+/*********************************************************************************************/
+/* Description: Greatest common divisor of two periods */
+static uint32 Os_Gcd(uint32 a, uint32 b)
+{
+    while(b != 0)
+    {
+        uint32 r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Choose the first release tick of each task, the offsets count from First_Tick:
+ * - The tasks with a fixed offset are placed first
+ * - The other tasks are placed from the heaviest one, each at the offset that gives the lowest
+ *   worst tick load over the hyperperiod (then the lowest total load on its ticks, then the earliest)
+ * Then the tasks are sorted by priority for the dispatch.
+ * A task with a period of 0 ticks (not built with OS_MS_TO_TICKS) is never released.
+ */
+static void Os_InitTasks(uint32 First_Tick)
+{
+    uint32 Tick_Load[OS_MAX_HYPERPERIOD_TICKS] = {0};
+    boolean Placed[OS_NUMBER_OF_TASKS] = {FALSE};
+    uint32 Hyperperiod = 1;
+    uint8 task;
+
+    for(task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        if(Os_Tasks[task].Period == 0)
+        {
+            /* No release tick to place */
+            Placed[task] = TRUE;
+            continue;
+        }
+        Hyperperiod = (Hyperperiod / Os_Gcd(Hyperperiod, Os_Tasks[task].Period)) * Os_Tasks[task].Period;
+        if(Hyperperiod > OS_MAX_HYPERPERIOD_TICKS)
+        {
+            /* Only the first ticks of a long hyperperiod are balanced */
+            Hyperperiod = OS_MAX_HYPERPERIOD_TICKS;
+        }
+    }
+    g_Hyperperiod = Hyperperiod;
+
+    for(task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        if((Placed[task] == FALSE) && (Os_Tasks[task].Offset != OS_TASK_OFFSET_AUTO))
+        {
+            for(uint32 tick = Os_Tasks[task].Offset % Os_Tasks[task].Period; tick < Hyperperiod; tick += Os_Tasks[task].Period)
+            {
+                Tick_Load[tick] += Os_Tasks[task].Load;
+            }
+            g_Task_Next_Release[task] = First_Tick + Os_Tasks[task].Offset;
+            Placed[task] = TRUE;
+        }
+    }
+
+    for(uint8 count = 0; count < OS_NUMBER_OF_TASKS; count++)
+    {
+        uint8 heaviest = OS_NUMBER_OF_TASKS;
+        uint32 best_offset = 0;
+        uint32 best_max = 0xFFFFFFFFUL;
+        uint32 best_sum = 0xFFFFFFFFUL;
+
+        /* Next task to place: the heaviest of the remaining tasks */
+        for(task = 0; task < OS_NUMBER_OF_TASKS; task++)
+        {
+            if((Placed[task] == FALSE) && ((heaviest == OS_NUMBER_OF_TASKS) || (Os_Tasks[task].Load > Os_Tasks[heaviest].Load)))
+            {
+                heaviest = task;
+            }
+        }
+        if(heaviest == OS_NUMBER_OF_TASKS)
+        {
+            break;
+        }
+
+        for(uint32 offset = 0; (offset < Os_Tasks[heaviest].Period) && (offset < Hyperperiod); offset++)
+        {
+            uint32 max = 0;
+            uint32 sum = 0;
+
+            for(uint32 tick = offset; tick < Hyperperiod; tick += Os_Tasks[heaviest].Period)
+            {
+                uint32 load = Tick_Load[tick] + Os_Tasks[heaviest].Load;
+                max = (load > max) ? load : max;
+                sum += load;
+            }
+            if((max < best_max) || ((max == best_max) && (sum < best_sum)))
+            {
+                best_max    = max;
+                best_sum    = sum;
+                best_offset = offset;
+            }
+        }
+
+        for(uint32 tick = best_offset; tick < Hyperperiod; tick += Os_Tasks[heaviest].Period)
+        {
+            Tick_Load[tick] += Os_Tasks[heaviest].Load;
+        }
+        g_Task_Next_Release[heaviest] = First_Tick + best_offset;
+        Placed[heaviest] = TRUE;
+    }
+
+    /* Dispatch order: insertion sort of the indexes of the released tasks from the highest priority value */
+    g_Task_Dispatch_Count = 0;
+    for(task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        uint8 position = g_Task_Dispatch_Count;
+
+        if(Os_Tasks[task].Period == 0)
+        {
+            continue;
+        }
+        while((position > 0) && (Os_Tasks[g_Task_Dispatch_Order[position - 1]].Priority < Os_Tasks[task].Priority))
+        {
+            g_Task_Dispatch_Order[position] = g_Task_Dispatch_Order[position - 1];
+            position--;
+        }
+        g_Task_Dispatch_Order[position] = task;
+        g_Task_Dispatch_Count++;
+    }
+}
+
+#if (OS_TASK_PROFILING == STD_ON) || (OS_CPU_LOAD_API == STD_ON)
+/*********************************************************************************************/
+/* Description: Enable the DWT cycle counter used by the task profiling and the CPU load (nothing for another cycle source) */
+static void Os_CycleCounterInit(void)
+{
+#ifdef OS_DWT_CYCLE_COUNTER
+    CORE_DEBUG_DEMCR_REG |= OS_DEMCR_TRCENA;
+    DWT_CYCCNT_REG        = 0;
+    DWT_CTRL_REG         |= OS_DWT_CYCCNTENA;
+#endif
+}
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+/* Description: Add one run of a task to its profile */
+static void Os_ProfileUpdate(uint8 Task, uint32 Cycles)
+{
+    Os_TaskProfileType * Profile_Ptr = &g_Task_Profile[Task];
+    uint32 Bin_Cycles = Cycles >> OS_PROFILE_FIRST_BIT;
+    uint8 bin = 0;
+
+    while((Bin_Cycles != 0) && (bin < (OS_PROFILE_HISTOGRAM_BINS - 1)))
+    {
+        Bin_Cycles >>= 1;
+        bin++;
+    }
+
+    Profile_Ptr->Count++;
+    Profile_Ptr->Last_Cycles   = Cycles;
+    Profile_Ptr->Total_Cycles += Cycles;
+    Profile_Ptr->Histogram[bin]++;
+    if(Cycles < Profile_Ptr->Min_Cycles)
+    {
+        Profile_Ptr->Min_Cycles = Cycles;
+    }
+    if(Cycles > Profile_Ptr->Max_Cycles)
+    {
+        Profile_Ptr->Max_Cycles = Cycles;
+    }
+}
+#endif
+
+#if (OS_CPU_LOAD_API == STD_ON)
+#if (OS_IDLE_WFI == STD_OFF)
+/*********************************************************************************************/
+/* Description: Idle until the tick count changes, returns the loop iterations (same loop for the calibration) */
+static uint32 Os_IdleLoopsUntilTick(uint32 Tick_Count)
+{
+    uint32 loops = 0;
+
+    while(g_Time_Tick_Count == Tick_Count)
+    {
+        loops++;
+    }
+    return loops;
+}
+#endif
+
+/*********************************************************************************************/
+/* Description: Add the load of one tick to the rolling windows of a source */
+static void Os_LoadWindowPush(Os_LoadWindowType * Window_Ptr, uint16 Permille)
+{
+    /* The slot leaving the hyperperiod window is g_Hyperperiod slots behind the new one */
+    uint32 Hyperperiod_Out = (g_Load_Index + OS_CPU_LOAD_LONG_WINDOW_TICKS - g_Hyperperiod) % OS_CPU_LOAD_LONG_WINDOW_TICKS;
+
+    Window_Ptr->Hyperperiod_Sum = Window_Ptr->Hyperperiod_Sum + Permille - Window_Ptr->Ring[Hyperperiod_Out];
+    Window_Ptr->Long_Sum        = Window_Ptr->Long_Sum + Permille - Window_Ptr->Ring[g_Load_Index];
+    Window_Ptr->Ring[g_Load_Index] = Permille;
+    Window_Ptr->Tick_Load = Permille;
+}
+
+/*********************************************************************************************/
+/*
+ * Description: Close the scheduling window that started at the previous handled tick, it lasted Ticks ticks:
+ * - DWT: busy cycles of the scheduler over all the cycles of the window
+ *   (with WFI the cycle counter stops in sleep, the window is Ticks SysTick periods)
+ * - Idle loop: 100% minus the idle loop iterations over the iterations of Ticks idle ticks (not with OS_IDLE_WFI)
+ */
+static void Os_LoadUpdate(uint32 Ticks)
+{
+    uint32 Now_Cycles = OS_PROFILE_CYCLE_COUNT();
+#if (OS_IDLE_WFI == STD_ON)
+    uint64 Window_Cycles = (uint64)SysTick_GetPeriodCycles() * Ticks;
+#else
+    uint64 Window_Cycles = Now_Cycles - g_Window_Start_Cycles;
+    uint32 Idle_Permille = (uint32)(((uint64)g_Idle_Loops * 1000U) / ((uint64)g_Idle_Loops_Per_Tick * Ticks));
+#endif
+    uint16 Load[OS_CPU_LOAD_MEASURED_SOURCES];
+
+    Load[OS_CPU_LOAD_DWT]       = (Window_Cycles != 0) ? (uint16)(((uint64)g_Busy_Cycles * 1000U) / Window_Cycles) : 0;
+#if (OS_IDLE_WFI == STD_ON)
+    if(Load[OS_CPU_LOAD_DWT] > 1000U)
+    {
+        /* A window counted in whole ticks can be slightly shorter than the busy time */
+        Load[OS_CPU_LOAD_DWT] = 1000U;
+    }
+#else
+    Load[OS_CPU_LOAD_IDLE_LOOP] = (Idle_Permille < 1000U) ? (uint16)(1000U - Idle_Permille) : 0;
+#endif
+
+    /* A window of several ticks (merged ticks) counts for each of its ticks */
+    for(uint32 tick = 0; (tick < Ticks) && (tick < OS_CPU_LOAD_LONG_WINDOW_TICKS); tick++)
+    {
+        for(uint8 source = 0; source < OS_CPU_LOAD_MEASURED_SOURCES; source++)
+        {
+            Os_LoadWindowPush(&g_Load_Window[source], Load[source]);
+        }
+        g_Load_Index = (g_Load_Index + 1) % OS_CPU_LOAD_LONG_WINDOW_TICKS;
+        if(g_Load_Ticks < OS_CPU_LOAD_LONG_WINDOW_TICKS)
+        {
+            g_Load_Ticks++;
+        }
+    }
+
+    g_Window_Start_Cycles = Now_Cycles;
+#if (OS_IDLE_WFI == STD_OFF)
+    g_Idle_Loops = 0;
+#endif
+}
+#endif
+
+/*********************************************************************************************/
+/*
+ * Description: Run the tasks released at or before the tick, from the highest priority.
+ * A task released several times while it was waiting runs once, the skipped releases are missed activations.
+ */
+static void Os_DispatchTasks(uint32 Tick)
+{
+    for(uint8 index = 0; index < g_Task_Dispatch_Count; index++)
+    {
+        uint8 task = g_Task_Dispatch_Order[index];
+
+        /* Wrap-safe comparison of the release tick with the current tick */
+        if((sint32)(Tick - g_Task_Next_Release[task]) >= 0)
+        {
+            uint32 Lateness = Tick - g_Task_Next_Release[task];
+            uint32 Missed   = Lateness / Os_Tasks[task].Period;
+
+#if (OS_TASK_PROFILING == STD_ON)
+            uint32 Start_Cycles = OS_PROFILE_CYCLE_COUNT();
+            Os_Tasks[task].Task_Ptr();
+            /* Unsigned difference, correct over one wrap of the 32-bit counter */
+            Os_ProfileUpdate(task, OS_PROFILE_CYCLE_COUNT() - Start_Cycles);
+#else
+            Os_Tasks[task].Task_Ptr();
+#endif
+            g_Task_Next_Release[task] += (Missed + 1) * Os_Tasks[task].Period;
+
+#if (OS_STATISTICS_API == STD_ON)
+            g_Task_Stats[task].Activations++;
+            g_Task_Stats[task].Missed_Activations += Missed;
+            if(Lateness > g_Task_Stats[task].Max_Lateness)
+            {
+                g_Task_Stats[task].Max_Lateness = Lateness;
+            }
+            /* The run overran when the tick of the next release already came */
+            if((sint32)((g_Time_Tick_Count - 1) - g_Task_Next_Release[task]) >= 0)
+            {
+                g_Task_Stats[task].Overruns++;
+            }
+#endif
+        }
+    }
+}
+
+#if (OS_TICKLESS == STD_ON)
+/*********************************************************************************************/
+/*
+ * Description: Ticks from the Tick to the earliest task release after it, limited to OS_TICKLESS_MAX_TICKS.
+ * The tasks released at or before the Tick are dispatched by then, their next release is whole periods later.
+ */
+static uint32 Os_TicksToNextRelease(uint32 Tick)
+{
+    uint32 Ticks = OS_TICKLESS_MAX_TICKS;
+
+    for(uint8 index = 0; index < g_Task_Dispatch_Count; index++)
+    {
+        uint8 task = g_Task_Dispatch_Order[index];
+        uint32 Release = g_Task_Next_Release[task];
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+        /* Wrap-safe comparison of the release tick with the tick */
+        if((sint32)(Tick - Release) >= 0)
+        {
+            Release += (((Tick - Release) / Os_Tasks[task].Period) + 1) * Os_Tasks[task].Period;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        if((Release - Tick) < Ticks)
+        {
+            Ticks = Release - Tick;
+        }
+    }
+    return Ticks;
+}
+#endif
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+#if (OS_IDLE_WFI == STD_ON)
+/*********************************************************************************************/
+/*
+ * Description: Sleep until the next interrupt when no tick came since Tick_Count was read.
+ * The tick count is checked again with the interrupts disabled: a tick arriving before the WFI
+ * stays pending and ends the WFI at once, then its ISR runs when the interrupts are enabled again.
+ * In tickless mode the SysTick count following the running one is stretched up to the next task release
+ * before the sleep: the running count cannot be changed without stopping the timer.
+ */
+static void Os_IdleHook(uint32 Tick_Count)
+{
+    Disable_Interrupts();
+    if(g_Time_Tick_Count == Tick_Count)
+    {
+#if (OS_TICKLESS == STD_ON)
+        /* Program the next count once, a wakeup by another interrupt keeps it */
+        if(g_Next_Step == 1)
+        {
+            /* The next count starts at the end of the running one, which is handled as tick Tick_Count + g_Tick_Step - 1 */
+            uint32 Ticks = Os_TicksToNextRelease(Tick_Count + g_Tick_Step - 1);
+            if((Ticks > 1) && (SysTick_SetNextPeriod((uint16)Ticks) == TRUE))
+            {
+                g_Next_Step = Ticks;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+#endif
+        Wait_For_Interrupt();
+#if (OS_STATISTICS_API == STD_ON)
+        g_Idle_Wakeups++;
+#endif
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    Enable_Interrupts();
+}
+#endif
 
 /*********************************************************************************************/
 void Os_start(void)
@@ -31,6 +510,14 @@ void Os_start(void)
     /* Global Interrupts Enable */
     Enable_Interrupts();
     
+#if (OS_TASK_PROFILING == STD_ON) || (OS_CPU_LOAD_API == STD_ON)
+    /* Start the cycle counter used to measure the tasks and the CPU load */
+    Os_CycleCounterInit();
+#endif
+#if (OS_TASK_PROFILING == STD_ON)
+    Os_ResetTaskProfiles();
+#endif
+
     /* 
      * Set the Call Back function to call Os_NewTimerTick
      * this function will be called every SysTick Interrupt (20ms)
@@ -38,10 +525,35 @@ void Os_start(void)
     SysTick_SetCallBack(Os_NewTimerTick);
 
     /* Start SysTickTimer to generate interrupt every 20ms */
+#if (OS_TICKLESS == STD_ON)
+    g_Tick_Step = 1;
+    g_Next_Step = 1;
+#endif
     SysTick_Start(OS_BASE_TIME);
 
+#if (OS_CPU_LOAD_API == STD_ON) && (OS_IDLE_WFI == STD_OFF)
+    /* Calibrate the idle loop: wait for a tick edge then count the iterations of a whole idle tick */
+    (void)Os_IdleLoopsUntilTick(g_Time_Tick_Count);
+    g_Idle_Loops_Per_Tick = Os_IdleLoopsUntilTick(g_Time_Tick_Count);
+    g_Idle_Loops_Per_Tick = (g_Idle_Loops_Per_Tick != 0) ? g_Idle_Loops_Per_Tick : 1;
+#endif
+
+    /* Compute the first release tick of each task (from the current tick) and the dispatch order */
+    g_Scheduler_Tick = g_Time_Tick_Count;
+#if (OS_STATISTICS_API == STD_ON) && (OS_TICKLESS == STD_ON)
+    g_Scheduler_Interrupts = g_Timer_Interrupts;
+#endif
+    Os_InitTasks(g_Scheduler_Tick);
+
+#if (OS_CPU_LOAD_API == STD_ON)
+    /* The Init Task is the busy time of the first scheduling window */
+    g_Window_Start_Cycles = OS_PROFILE_CYCLE_COUNT();
+    Init_Task();
+    g_Busy_Cycles = OS_PROFILE_CYCLE_COUNT() - g_Window_Start_Cycles;
+#else
     /* Execute the Init Task */
     Init_Task();
+#endif
 
     /* Start the Os Scheduler */
     Os_Scheduler();
@@ -50,11 +562,33 @@ void Os_start(void)
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
-
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+#if (OS_STATISTICS_API == STD_ON) && (OS_TICKLESS == STD_ON)
+    g_Timer_Interrupts++;
+#endif
+#if (OS_TICKLESS == STD_ON)
+    /* Increment the Os time by the ticks of the count that ended, the programmed count is now running */
+    g_Time_Tick_Count += g_Tick_Step;
+    g_Tick_Step = g_Next_Step;
+    if(g_Next_Step != 1)
+    {
+        /* The count after a stretched one lasts one tick again, a refused change keeps the stretched length */
+        if(SysTick_SetNextPeriod(1) == TRUE)
+        {
+            g_Next_Step = 1;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#else
+    /* Increment the Os time by one tick (OS_BASE_TIME ms), the scheduler handles the pending ticks */
+    g_Time_Tick_Count++;
+#endif
 }
 
 /*********************************************************************************************/
@@ -62,37 +596,150 @@ void Os_Scheduler(void)
 {
     while(1)
     {
-	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
+	/* Only the ISR writes the tick count, a single 32-bit read needs no critical section */
+	uint32 Tick_Count = g_Time_Tick_Count;
+#if (OS_STATISTICS_API == STD_ON) && (OS_TICKLESS == STD_ON)
+	uint32 Interrupts;
+
+	/* Read the interrupt count and the tick count of the same interrupt */
+	do
 	{
-	    switch(g_Time_Tick_Count)
-            {
-		case 20:
-		case 100:
-			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 40:
-		case 80:
-			    Button_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 60:
-			    Button_Task();
-			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    break;
-		case 120:
-			    Button_Task();
-			    App_Task();
-			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
-			    g_Time_Tick_Count = 0;
-			    break;
-            }
+	    Interrupts = g_Timer_Interrupts;
+	    Tick_Count = g_Time_Tick_Count;
+	} while(Interrupts != g_Timer_Interrupts);
+#endif
+
+	/* Code is only executed in case there are pending timer ticks */
+	if(Tick_Count != g_Scheduler_Tick)
+	{
+#if (OS_STATISTICS_API == STD_ON)
+	    /* All the ticks after the first pending one came while the scheduler was still busy */
+#if (OS_TICKLESS == STD_ON)
+	    g_Lost_Ticks += (Interrupts - g_Scheduler_Interrupts) - 1;
+	    g_Scheduler_Interrupts = Interrupts;
+#else
+	    g_Lost_Ticks += (Tick_Count - g_Scheduler_Tick) - 1;
+#endif
+#endif
+#if (OS_CPU_LOAD_API == STD_ON)
+	    Os_LoadUpdate(Tick_Count - g_Scheduler_Tick);
+#endif
+	    g_Scheduler_Tick = Tick_Count;
+
+	    /* Run the tasks released up to the latest tick */
+	    Os_DispatchTasks(Tick_Count - 1);
+#if (OS_CPU_LOAD_API == STD_ON)
+	    g_Busy_Cycles = OS_PROFILE_CYCLE_COUNT() - g_Window_Start_Cycles;
+#endif
+	}
+#if (OS_IDLE_WFI == STD_ON)
+	else
+	{
+	    /* Nothing to run until the next tick */
+	    Os_IdleHook(Tick_Count);
+	}
+#elif (OS_CPU_LOAD_API == STD_ON)
+	else
+	{
+	    /* Nothing to run until the next tick */
+	    g_Idle_Loops += Os_IdleLoopsUntilTick(Tick_Count);
 	}
+#endif
+    }
+
+}
+/*********************************************************************************************/
+
+#if (OS_STATISTICS_API == STD_ON)
+Std_ReturnType Os_GetTaskStats(uint8 TaskIndex, Os_TaskStatsType * Stats_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((TaskIndex < OS_NUMBER_OF_TASKS) && (Stats_Ptr != NULL_PTR))
+    {
+        *Stats_Ptr = g_Task_Stats[TaskIndex];
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetLostTicks(void)
+{
+    return g_Lost_Ticks;
+}
+
+#if (OS_IDLE_WFI == STD_ON)
+/*********************************************************************************************/
+uint32 Os_GetIdleWakeups(void)
+{
+    return g_Idle_Wakeups;
+}
+#endif
+
+/*********************************************************************************************/
+void Os_ResetStats(void)
+{
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        g_Task_Stats[task] = (Os_TaskStatsType){0};
+    }
+    g_Lost_Ticks = 0;
+#if (OS_IDLE_WFI == STD_ON)
+    g_Idle_Wakeups = 0;
+#endif
+}
+/*********************************************************************************************/
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+Std_ReturnType Os_GetTaskProfile(uint8 TaskIndex, Os_TaskProfileType * Profile_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((TaskIndex < OS_NUMBER_OF_TASKS) && (Profile_Ptr != NULL_PTR))
+    {
+        *Profile_Ptr = g_Task_Profile[TaskIndex];
+        Profile_Ptr->Mean_Cycles = (Profile_Ptr->Count != 0) ? (uint32)(Profile_Ptr->Total_Cycles / Profile_Ptr->Count) : 0;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+void Os_ResetTaskProfiles(void)
+{
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        g_Task_Profile[task] = (Os_TaskProfileType){0};
+        g_Task_Profile[task].Min_Cycles = 0xFFFFFFFFUL;
     }
+}
+/*********************************************************************************************/
+#endif
+
+#if (OS_CPU_LOAD_API == STD_ON)
+Std_ReturnType Os_GetCpuLoad(uint8 Source, Os_CpuLoadType * Load_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
 
+#if (OS_IDLE_WFI == STD_ON)
+    /* The idle loop is replaced by WFI, only the DWT source measures the load */
+    if((Source == OS_CPU_LOAD_DWT) && (Load_Ptr != NULL_PTR))
+#else
+    if((Source < OS_CPU_LOAD_SOURCES) && (Load_Ptr != NULL_PTR))
+#endif
+    {
+        const Os_LoadWindowType * Window_Ptr = &g_Load_Window[Source];
+        uint32 Hyperperiod_Ticks = (g_Load_Ticks < g_Hyperperiod) ? g_Load_Ticks : g_Hyperperiod;
+
+        /* Permille sums averaged over the filled ticks of each window then converted to percent */
+        Load_Ptr->Tick_Load        = (uint8)(Window_Ptr->Tick_Load / 10U);
+        Load_Ptr->Hyperperiod_Load = (Hyperperiod_Ticks != 0) ? (uint8)(Window_Ptr->Hyperperiod_Sum / Hyperperiod_Ticks / 10U) : 0;
+        Load_Ptr->Long_Load        = (g_Load_Ticks != 0) ? (uint8)(Window_Ptr->Long_Sum / g_Load_Ticks / 10U) : 0;
+        ret = E_OK;
+    }
+    return ret;
 }
 /*********************************************************************************************/
+#endif
@@ -13,23 +13,114 @@
 #define OS_H_
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
 /* Timer counting time in ms */
 #define OS_BASE_TIME 20
 
+/* Time in ms converted to ticks, the compilation fails when the time is not a non-zero multiple of OS_BASE_TIME */
+#define OS_MS_TO_TICKS(MS)      ((uint16)(((MS) / OS_BASE_TIME) + \
+                                 (0U * sizeof(char[((((MS) % OS_BASE_TIME) == 0) && ((MS) >= OS_BASE_TIME)) ? 1 : -1]))))
+
+/* Task offset chosen by Os_start to spread the load of the tasks over the ticks */
+#define OS_TASK_OFFSET_AUTO     (0xFFFFU)
+
+/* Description: Periodic task description, see the Os_Tasks table in Os_Cfg.c */
+typedef struct
+{
+    void (*Task_Ptr)(void); /* Task function */
+    uint16 Period;          /* Period in ticks, a task with a period of 0 is never released */
+    uint16 Offset;          /* First release tick or OS_TASK_OFFSET_AUTO */
+    uint8  Priority;        /* Tasks released at the same tick run from the highest priority value */
+    uint16 Load;            /* Estimated execution time in us, used for the automatic offsets */
+}Os_TaskConfigType;
+
+/* Description: Timing statistics of one task, in ticks of OS_BASE_TIME ms */
+typedef struct
+{
+    uint32 Activations;        /* Number of runs of the task */
+    uint32 Missed_Activations; /* Releases skipped because the task was still waiting for a previous one */
+    uint32 Overruns;           /* Runs finished after the next release of the task */
+    uint32 Max_Lateness;       /* Maximum delay between a release and the start of the run */
+}Os_TaskStatsType;
+
+/* Description: Execution time profile of one task, in cycles of the system clock */
+typedef struct
+{
+    uint32 Count;                                 /* Number of measured runs */
+    uint32 Last_Cycles;                           /* Execution time of the last run */
+    uint32 Min_Cycles;                            /* Shortest run */
+    uint32 Max_Cycles;                            /* Longest run */
+    uint32 Mean_Cycles;                           /* Mean of the runs, computed by Os_GetTaskProfile */
+    uint64 Total_Cycles;                          /* Sum of the runs */
+    uint32 Histogram[OS_PROFILE_HISTOGRAM_BINS];  /* Runs per power of two execution time, see Os_Cfg.h */
+}Os_TaskProfileType;
+
+/* Sources of the CPU load measurement */
+#define OS_CPU_LOAD_DWT         (0U)   /* Busy cycles of the scheduler counted by the DWT cycle counter */
+#define OS_CPU_LOAD_IDLE_LOOP   (1U)   /* Idle loop iterations against the iterations of an idle tick (not with OS_IDLE_WFI) */
+#define OS_CPU_LOAD_SOURCES     (2U)
+
+/* Description: Rolling CPU load in percent over the last tick, the last hyperperiod and the long window */
+typedef struct
+{
+    uint8 Tick_Load;
+    uint8 Hyperperiod_Load;
+    uint8 Long_Load;
+}Os_CpuLoadType;
+
+/* Periodic tasks of the application */
+extern const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS];
+
 /* Description: 
  * Function responsible for:
  * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 2. Start the Os timer (and calibrate the idle loop of the CPU load measurement when WFI is not used)
+ * 3. Compute the first release tick of each task (automatic offsets)
+ * 4. Execute the Init Task
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/*
+ * Description: The Engine of the Os Scheduler, runs the tasks released at each tick from the Os_Tasks table
+ * and sleeps with WFI between the ticks (OS_IDLE_WFI), or up to the next task release (OS_TICKLESS)
+ */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+#if (OS_STATISTICS_API == STD_ON)
+/* Description: Copy the statistics of the task at TaskIndex in the Os_Tasks table, E_NOT_OK for an invalid index */
+Std_ReturnType Os_GetTaskStats(uint8 TaskIndex, Os_TaskStatsType * Stats_Ptr);
+
+/* Description: Return the number of ticks merged into a later tick because the scheduler was still busy */
+uint32 Os_GetLostTicks(void);
+
+#if (OS_IDLE_WFI == STD_ON)
+/* Description: Return the number of wakeups from WFI in the idle of the scheduler */
+uint32 Os_GetIdleWakeups(void);
+#endif
+
+/* Description: Clear the statistics of all the tasks, the lost ticks and the idle wakeups */
+void Os_ResetStats(void);
+#endif
+
+#if (OS_TASK_PROFILING == STD_ON)
+/* Description: Copy the execution time profile of the task at TaskIndex in the Os_Tasks table, E_NOT_OK for an invalid index */
+Std_ReturnType Os_GetTaskProfile(uint8 TaskIndex, Os_TaskProfileType * Profile_Ptr);
+
+/* Description: Clear the execution time profiles of all the tasks */
+void Os_ResetTaskProfiles(void);
+#endif
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/*
+ * Description: Copy the CPU load measured by the Source (OS_CPU_LOAD_DWT/OS_CPU_LOAD_IDLE_LOOP), E_NOT_OK for an invalid
+ * source or for OS_CPU_LOAD_IDLE_LOOP when OS_IDLE_WFI is STD_ON
+ */
+Std_ReturnType Os_GetCpuLoad(uint8 Source, Os_CpuLoadType * Load_Ptr);
+#endif
+
 #endif /* OS_H_ */
@@ -0,0 +1,27 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.c
+ *
+ * Description: Task table of the Os Scheduler.
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#include "Os.h"
+#include "App.h"
+
+/*
+ * Periodic tasks of the application:
+ * - Period and offset in ticks of OS_BASE_TIME ms (OS_MS_TO_TICKS fails the compilation for other times)
+ * - OS_TASK_OFFSET_AUTO lets Os_start choose the offset that keeps the worst tick the lightest
+ * - Priority: the tasks released at the same tick run from the highest priority value
+ * - Load: estimated execution time in us, only used to choose the automatic offsets
+ */
+const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS] = {
+    /*   Task     ,      Period        ,       Offset       , Priority, Load */
+    { Button_Task , OS_MS_TO_TICKS(20) , OS_TASK_OFFSET_AUTO ,    3    ,  20  },
+    { Led_Task    , OS_MS_TO_TICKS(40) , OS_TASK_OFFSET_AUTO ,    2    ,  10  },
+    { App_Task    , OS_MS_TO_TICKS(60) , OS_TASK_OFFSET_AUTO ,    1    ,  30  }
+};
@@ -0,0 +1,59 @@
+ /******************************************************************************
+ *
+ * Module: Os
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Number of the periodic tasks in the Os_Tasks table (Os_Cfg.c) */
+#define OS_NUMBER_OF_TASKS              (3U)
+
+/*
+ * Maximum number of ticks of the hyperperiod (LCM of the task periods) used to choose the
+ * automatic task offsets, a longer hyperperiod is only balanced over its first ticks
+ */
+#define OS_MAX_HYPERPERIOD_TICKS        (32U)
+
+/* Pre-compile option for the task statistics (overruns, missed activations, lateness) and their APIs */
+#define OS_STATISTICS_API               (STD_ON)
+
+/*
+ * Pre-compile option for the execution time profiling of each task with the DWT cycle counter,
+ * nothing is measured and no RAM is used when it is STD_OFF
+ */
+#define OS_TASK_PROFILING               (STD_ON)
+
+/*
+ * Histogram of the task execution times: bin 0 counts the runs below 2^OS_PROFILE_FIRST_BIT cycles,
+ * bin n the runs from 2^(OS_PROFILE_FIRST_BIT + n - 1) cycles and the last bin all the longer runs
+ */
+#define OS_PROFILE_HISTOGRAM_BINS       (8U)
+#define OS_PROFILE_FIRST_BIT            (8U)
+
+/* Pre-compile option for the CPU load measurement (DWT cycles and calibrated idle loop) and its API */
+#define OS_CPU_LOAD_API                 (STD_ON)
+
+/* Ticks of the long CPU load window (50 ticks of 20 ms --> 1 s), not less than OS_MAX_HYPERPERIOD_TICKS */
+#define OS_CPU_LOAD_LONG_WINDOW_TICKS   (50U)
+
+/*
+ * Pre-compile option to sleep with WFI when no tick is pending (the core clock stops until the next interrupt),
+ * the idle loop CPU load source is not available when it is STD_ON
+ */
+#define OS_IDLE_WFI                     (STD_ON)
+
+/*
+ * Pre-compile option for the tickless idle: the SysTick period is stretched up to the next task release
+ * (at most OS_TICKLESS_MAX_TICKS ticks) instead of waking every OS_BASE_TIME ms, needs OS_IDLE_WFI
+ */
+#define OS_TICKLESS                     (STD_OFF)
+#define OS_TICKLESS_MAX_TICKS           (25U)
+
+#endif /* OS_CFG_H_ */
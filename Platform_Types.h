@@ -74,8 +74,14 @@ typedef unsigned char         uint8;          /*           0 .. 255
 typedef signed char           sint8;          /*        -128 .. +127            */
 typedef unsigned short        uint16;         /*           0 .. 65535           */
 typedef signed short          sint16;         /*      -32768 .. +32767          */
+#if defined(__LP64__)
+/* 64-bit host build (register model tests): long is 64-bit there */
+typedef unsigned int          uint32;         /*           0 .. 4294967295      */
+typedef signed int            sint32;         /* -2147483648 .. +2147483647     */
+#else
 typedef unsigned long         uint32;         /*           0 .. 4294967295      */
 typedef signed long           sint32;         /* -2147483648 .. +2147483647     */
+#endif
 typedef unsigned long long    uint64;         /*       0..18446744073709551615  */
 typedef signed long long      sint64;
 typedef float                 float32;
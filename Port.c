@@ -25,6 +25,13 @@
    
 #endif
    
+/* The packed pin configuration shall fit in 4 bytes (43 pins --> 172 bytes of flash) */
+typedef char Port_ConfigPinSizeCheck[(sizeof(Port_ConfigPin) == 4U) ? 1 : -1];
+
+/* The used ports shall be described in Gpio_Ports.c and fit in the 3 bits port number of Port_ConfigPin */
+typedef char Port_NumberOfPortsCheck[((PORT_NUMBER_OF_PORTS <= GPIO_NUMBER_OF_PORTS) && (PORT_NUMBER_OF_PORTS <= 8U)) ? 1 : -1];
+typedef char Port_NumberOfModesCheck[((PORT_PIN_MODE_ADC + 1) == GPIO_NUMBER_OF_MODES) ? 1 : -1];
+
 /*******************************************************************************
                           Local Variables                                    
 *******************************************************************************/
@@ -35,261 +42,1094 @@ uint8 port_status = PORT_NOT_INITIALIZED;
 /*Contains the pointer to which points to Port_PinConfig */
 const Port_ConfigType* Port_ConfigPtr = NULL_PTR;
 
+/* Register images of each port folded from the pins configuration by Port_Init */
+STATIC Port_PortImageType Port_PortImage[PORT_NUMBER_OF_PORTS];
+
+/* RAM shadow of the configuration registers of each port, written by Port_Init and all the Port APIs */
+STATIC Port_ShadowRegsType Port_Shadow[PORT_NUMBER_OF_PORTS];
+
+/* Pins whose direction was restored by the last Port_RefreshPortDirection call, per port */
+STATIC uint8 Port_DirectionDrift[PORT_NUMBER_OF_PORTS];
+
+#if (PORT_WARM_BOOT == STD_ON)
+/* Configuration programmed by the last Port_Init, not initialized by the startup code */
+STATIC NO_INIT Port_WarmBootRecordType Port_WarmBootRecord;
+#endif
+
+/*******************************************************************************
+                          Local Functions                                    
+*******************************************************************************/
+
+/*******************************************************************************
+* Service Name: Port_WriteRegister
+* Description: Local function to write the bits of a register owned by the configuration.
+*              The RAM shadow of the register is updated then stored with a single write,
+*              the bits not owned by the configuration are kept without reading the register.
+*******************************************************************************/
+STATIC void Port_WriteRegister(volatile uint8 * PortGpio_Ptr, uint16 Offset, uint32 * Shadow_Reg_Ptr, uint32 Value, uint32 Mask)
+{
+  *Shadow_Reg_Ptr = (*Shadow_Reg_Ptr & ~Mask) | (Value & Mask);
+  *(volatile uint32 *)(PortGpio_Ptr + Offset) = *Shadow_Reg_Ptr;
+}
+
+/*******************************************************************************
+* Service Name: Port_WriteRegisterDiff
+* Description: Local function to write the owned bits of a register only when they differ
+*              from its RAM shadow
+*******************************************************************************/
+STATIC void Port_WriteRegisterDiff(volatile uint8 * PortGpio_Ptr, uint16 Offset, uint32 * Shadow_Reg_Ptr, uint32 Value, uint32 Mask)
+{
+  if(((*Shadow_Reg_Ptr ^ Value) & Mask) != 0)
+  {
+    Port_WriteRegister(PortGpio_Ptr, Offset, Shadow_Reg_Ptr, Value, Mask);
+  }
+  else
+  {
+    /* Do Nothing ... the register already holds the Value */
+  }
+}
+
+/*******************************************************************************
+* Service Name: Port_LoadShadow
+* Description: Local function to read the configuration registers of one port into their
+*              RAM shadow, only needed when the port is not wholly owned by the configuration
+*******************************************************************************/
+STATIC void Port_LoadShadow(uint8 PortNum)
+{
+  volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(PortNum);
+  Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[PortNum];
+  
+  Shadow_Ptr->Dir   = *(volatile uint32 *)(PortGpio_Ptr + PORT_DIR_REG_OFFSET);
+  Shadow_Ptr->Pur   = *(volatile uint32 *)(PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET);
+  Shadow_Ptr->Pdr   = *(volatile uint32 *)(PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET);
+  Shadow_Ptr->Amsel = *(volatile uint32 *)(PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET);
+  Shadow_Ptr->Afsel = *(volatile uint32 *)(PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET);
+  Shadow_Ptr->Pctl  = *(volatile uint32 *)(PortGpio_Ptr + PORT_CTL_REG_OFFSET);
+  Shadow_Ptr->Den   = *(volatile uint32 *)(PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET);
+  Shadow_Ptr->Dr2r  = *(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_2MA_REG_OFFSET);
+  Shadow_Ptr->Dr4r  = *(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_4MA_REG_OFFSET);
+  Shadow_Ptr->Dr8r  = *(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_8MA_REG_OFFSET);
+  Shadow_Ptr->Odr   = *(volatile uint32 *)(PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET);
+  Shadow_Ptr->Slr   = *(volatile uint32 *)(PortGpio_Ptr + PORT_SLEW_RATE_REG_OFFSET);
+}
+
+/*******************************************************************************
+* Service Name: Port_PinsToPctlMask
+* Description: Local function to expand a pins mask to the mask of their PMCx bits in GPIOPCTL
+*******************************************************************************/
+STATIC uint32 Port_PinsToPctlMask(uint8 Pins_Mask)
+{
+  uint32 Pctl_Mask = 0;
+  
+  for(uint8 pin = 0; pin < 8; pin++)
+  {
+    if(Pins_Mask & (1U << pin))
+    {
+      Pctl_Mask |= (0x0000000FUL << (pin * 4));
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  
+  return Pctl_Mask;
+}
+
+/*******************************************************************************
+* Service Name: Port_WriteMode
+* Description: Local function to set the mode of the masked pins of one port with a single
+*              store in each of GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN registers
+*******************************************************************************/
+STATIC void Port_WriteMode(uint8 PortNum, uint8 Pins_Mask, Port_PinModeType Mode)
+{
+  volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(PortNum);
+  Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[PortNum];
+  uint32 Pctl_Mask = Port_PinsToPctlMask(Pins_Mask);
+  
+  if(Mode == PORT_PIN_MODE_DIO)
+  {
+    /* Digital GPIO pins: no analog, no alternative function, PMCx bits cleared */
+    Port_WriteRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, &Shadow_Ptr->Amsel, 0,         Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET,        &Shadow_Ptr->Afsel, 0,         Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET,             &Shadow_Ptr->Pctl,  0,         Pctl_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET,  &Shadow_Ptr->Den,   Pins_Mask, Pins_Mask);
+  }
+  else if(Mode == PORT_PIN_MODE_ADC)
+  {
+    /* Analog pins: digital disabled, alternative function and analog enabled, PMCx bits cleared */
+    Port_WriteRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET,  &Shadow_Ptr->Den,   0,         Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET,        &Shadow_Ptr->Afsel, Pins_Mask, Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET,             &Shadow_Ptr->Pctl,  0,         Pctl_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, &Shadow_Ptr->Amsel, Pins_Mask, Pins_Mask);
+  }
+  else /* Another mode */
+  {
+    /* Digital alternative function pins, the mode is replicated in the PMCx bits of each pin */
+    Port_WriteRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, &Shadow_Ptr->Amsel, 0,         Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET,        &Shadow_Ptr->Afsel, Pins_Mask, Pins_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET,             &Shadow_Ptr->Pctl,  0x11111111UL * (Mode & 0x0000000F), Pctl_Mask);
+    Port_WriteRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET,  &Shadow_Ptr->Den,   Pins_Mask, Pins_Mask);
+  }
+}
+
+/*******************************************************************************
+* Service Name: Port_WriteImage
+* Description: Local function to commit the register image of one port:
+*              - Unlock and commit the locked pins
+*              - Write the initial output values through the GPIODATA address mask
+*              - Write each configuration register once
+*******************************************************************************/
+STATIC void Port_WriteImage(uint8 PortNum, const Port_PortImageType * Image_Ptr)
+{
+  volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(PortNum);
+  Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[PortNum];
+  uint32 Mask = Image_Ptr->Configured;
+  uint32 Pctl_Mask = Port_PinsToPctlMask(Image_Ptr->Configured);
+  
+  if(Image_Ptr->Commit != 0)
+  {
+    /* Unlock the GPIOCR register */
+    *(volatile uint32 *)(PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
+    
+    /* Set the corresponding bits in GPIOCR register to allow changes on these pins */
+    *(volatile uint32 *)(PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) |= Image_Ptr->Commit;
+  }
+  else
+  {
+    /* Do Nothing ... No need to unlock the commit register for this port */
+  }
+  
+  /* Initial output values first, only the configured pins are addressed by the GPIODATA address mask */
+  *(volatile uint32 *)(PortGpio_Ptr + ((uint32)Image_Ptr->Configured << 2)) = Image_Ptr->Data;
+  
+  /* Output stage before the direction: open drain, drive strength (one of 2/4/8 mA per pin) and slew rate */
+  Port_WriteRegister(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET,      &Shadow_Ptr->Odr,   Image_Ptr->Odr,   Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET,       &Shadow_Ptr->Dr2r,  Image_Ptr->Dr2r,  Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET,       &Shadow_Ptr->Dr4r,  Image_Ptr->Dr4r,  Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET,       &Shadow_Ptr->Dr8r,  Image_Ptr->Dr8r,  Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET,       &Shadow_Ptr->Slr,   Image_Ptr->Slr,   Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_DIR_REG_OFFSET,             &Shadow_Ptr->Dir,   Image_Ptr->Dir,   Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET,         &Shadow_Ptr->Pur,   Image_Ptr->Pur,   Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET,       &Shadow_Ptr->Pdr,   Image_Ptr->Pdr,   Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, &Shadow_Ptr->Amsel, Image_Ptr->Amsel, Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET,        &Shadow_Ptr->Afsel, Image_Ptr->Afsel, Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_CTL_REG_OFFSET,             &Shadow_Ptr->Pctl,  Image_Ptr->Pctl,  Pctl_Mask);
+  Port_WriteRegister(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET,  &Shadow_Ptr->Den,   Image_Ptr->Den,   Mask);
+}
+
+/*******************************************************************************
+* Service Name: Port_WriteImageDiff
+* Description: Local function to move one port from a register image to a new one
+*              that owns the same pins, only the registers that differ from their
+*              RAM shadow are written:
+*              - The GPIOCR register is only committed for newly locked pins
+*              - Only the changed output values are written through the GPIODATA address mask
+*******************************************************************************/
+STATIC void Port_WriteImageDiff(uint8 PortNum, const Port_PortImageType * Old_Ptr, const Port_PortImageType * New_Ptr)
+{
+  volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(PortNum);
+  Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[PortNum];
+  uint32 Mask = New_Ptr->Configured;
+  uint32 Pctl_Mask = Port_PinsToPctlMask(New_Ptr->Configured);
+  uint8 Data_Changed = (uint8)((Old_Ptr->Data ^ New_Ptr->Data) & New_Ptr->Configured);
+  
+  if((New_Ptr->Commit & ~Old_Ptr->Commit) != 0)
+  {
+    /* Unlock the GPIOCR register */
+    *(volatile uint32 *)(PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
+    
+    /* Set the corresponding bits in GPIOCR register to allow changes on these pins */
+    *(volatile uint32 *)(PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) |= New_Ptr->Commit;
+  }
+  else
+  {
+    /* Do Nothing ... the locked pins are already committed */
+  }
+  
+  if(Data_Changed != 0)
+  {
+    /* Only the changed output values are addressed by the GPIODATA address mask */
+    *(volatile uint32 *)(PortGpio_Ptr + ((uint32)Data_Changed << 2)) = New_Ptr->Data;
+  }
+  else
+  {
+    /* Do Nothing */
+  }
+  
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET,      &Shadow_Ptr->Odr,   New_Ptr->Odr,   Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET,       &Shadow_Ptr->Dr2r,  New_Ptr->Dr2r,  Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET,       &Shadow_Ptr->Dr4r,  New_Ptr->Dr4r,  Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET,       &Shadow_Ptr->Dr8r,  New_Ptr->Dr8r,  Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET,       &Shadow_Ptr->Slr,   New_Ptr->Slr,   Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_DIR_REG_OFFSET,             &Shadow_Ptr->Dir,   New_Ptr->Dir,   Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_PULL_UP_REG_OFFSET,         &Shadow_Ptr->Pur,   New_Ptr->Pur,   Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_PULL_DOWN_REG_OFFSET,       &Shadow_Ptr->Pdr,   New_Ptr->Pdr,   Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_ANALOG_MODE_SEL_REG_OFFSET, &Shadow_Ptr->Amsel, New_Ptr->Amsel, Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_ALT_FUNC_REG_OFFSET,        &Shadow_Ptr->Afsel, New_Ptr->Afsel, Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_CTL_REG_OFFSET,             &Shadow_Ptr->Pctl,  New_Ptr->Pctl,  Pctl_Mask);
+  Port_WriteRegisterDiff(PortGpio_Ptr, PORT_DIGITAL_ENABLE_REG_OFFSET,  &Shadow_Ptr->Den,   New_Ptr->Den,   Mask);
+}
+
+/*******************************************************************************
+* Service Name: Port_LoadImages
+* Description: Local function to get the register images of each port of a configuration:
+*              copied from the precomputed images or folded from the pins configuration
+*******************************************************************************/
+STATIC void Port_LoadImages(const Port_ConfigType * ConfigPtr, Port_PortImageType * Images)
+{
+  if(ConfigPtr->Images != NULL_PTR)
+  {
+    /* Fast path: the register images were precomputed and validated offline by Tools/Port_Generator */
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      Images[port] = ConfigPtr->Images[port];
+    }
+  }
+  else
+  {
+    /* Fold the pins configuration into one register image per port */
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      Images[port] = (Port_PortImageType){0};
+    }
+  
+    for(Port_PinType pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+    {
+      const Port_ConfigPin * Pin_Ptr = &ConfigPtr->Pin[pin];
+      Port_PortImageType * Image_Ptr = &Images[PORT_PIN_PORT_NUM(Pin_Ptr)];
+      uint8 Pin_Mask = (uint8)(1U << PORT_PIN_PIN_NUM(Pin_Ptr));
+    
+      const Gpio_PortDescriptorType * Desc_Ptr = &Gpio_PortDescriptors[PORT_PIN_PORT_NUM(Pin_Ptr)];
+    
+      if((Desc_Ptr->Jtag_Pins & Pin_Mask) != 0)
+      {
+        /* Do Nothing ...  this is the JTAG pins */
+        continue;
+      }
+      else if((Desc_Ptr->Commit_Pins & Pin_Mask) != 0)
+      {
+        /* This pin is locked, it needs the GPIOCR register to be unlocked and committed */
+        Image_Ptr->Commit |= Pin_Mask;
+      }
+      else
+      {
+        /* Do Nothing ... No need to unlock the commit register for this pin */
+      }
+    
+      Image_Ptr->Configured |= Pin_Mask;
+    
+      if(PORT_PIN_DIRECTION_CHANGE(Pin_Ptr) == STD_OFF)
+      {
+        /* The direction of this pin is refreshed by Port_RefreshPortDirection */
+        Image_Ptr->Dir_Locked |= Pin_Mask;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+    
+      if(PORT_PIN_MODE_CHANGE(Pin_Ptr) == STD_OFF)
+      {
+        /* The mode of this pin can't be changed by Port_SetPinMode or Port_SetPortModeMask */
+        Image_Ptr->Mode_Locked |= Pin_Mask;
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+    
+      if(PORT_PIN_DRIVE(Pin_Ptr) == PORT_PIN_DRIVE_8MA)
+      {
+        /* 8 mA drive, with its optional slew rate control */
+        Image_Ptr->Dr8r |= Pin_Mask;
+        
+        if(PORT_PIN_SLEW_RATE(Pin_Ptr) == STD_ON)
+        {
+          Image_Ptr->Slr |= Pin_Mask;
+        }
+        else
+        {
+          /* Do Nothing */
+        }
+      }
+      else if(PORT_PIN_DRIVE(Pin_Ptr) == PORT_PIN_DRIVE_4MA)
+      {
+        Image_Ptr->Dr4r |= Pin_Mask;
+      }
+      else
+      {
+        /* Default 2 mA drive */
+        Image_Ptr->Dr2r |= Pin_Mask;
+      }
+    
+      if(PORT_PIN_OPEN_DRAIN(Pin_Ptr) == STD_ON)
+      {
+        Image_Ptr->Odr |= Pin_Mask;
+      }
+      else
+      {
+        /* Do Nothing ... push-pull output */
+      }
+    
+      if(PORT_PIN_DIRECTION(Pin_Ptr) == PORT_PIN_OUT)
+      {
+        /* Output pin with its initial value */
+        Image_Ptr->Dir |= Pin_Mask;
+      
+        if(PORT_PIN_INITIAL_VALUE(Pin_Ptr) == PORT_PIN_LEVEL_HIGH)
+        {
+          Image_Ptr->Data |= Pin_Mask;
+        }
+        else
+        {
+          /* Do Nothing ... initial value 0 */
+        }
+      }
+      else if(PORT_PIN_DIRECTION(Pin_Ptr) == PORT_PIN_IN)
+      {
+        /* Input pin with its internal resistor */
+        if(PORT_PIN_RESISTOR(Pin_Ptr) == PULL_UP)
+        {
+          Image_Ptr->Pur |= Pin_Mask;
+        }
+        else if(PORT_PIN_RESISTOR(Pin_Ptr) == PULL_DOWN)
+        {
+          Image_Ptr->Pdr |= Pin_Mask;
+        }
+        else
+        {
+          /* Do Nothing ... internal resistor disabled */
+        }
+      }
+      else
+      {
+        /* Do Nothing */
+      }
+    
+      if(PORT_PIN_INITIAL_MODE(Pin_Ptr) == PORT_PIN_MODE_DIO)
+      {
+        /* Digital GPIO pin: no analog, no alternative function, PMCx bits cleared */
+        Image_Ptr->Den |= Pin_Mask;
+      }
+      else if(PORT_PIN_INITIAL_MODE(Pin_Ptr) == PORT_PIN_MODE_ADC)
+      {
+        /* Analog pin: digital disabled, alternative function and analog enabled, PMCx bits cleared */
+        Image_Ptr->Afsel |= Pin_Mask;
+        Image_Ptr->Amsel |= Pin_Mask;
+      }
+      else /* Another mode */
+      {
+        /* Digital alternative function pin with its PMCx bits */
+        Image_Ptr->Afsel |= Pin_Mask;
+        Image_Ptr->Pctl  |= ((uint32)PORT_PIN_INITIAL_MODE(Pin_Ptr) & 0x0000000F) << (PORT_PIN_PIN_NUM(Pin_Ptr) * 4);
+        Image_Ptr->Den   |= Pin_Mask;
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+* Service Name: Port_EnableClocks
+* Description: Local function to enable the clock of the masked ports with one write
+*              and wait once until they are ready
+*******************************************************************************/
+STATIC void Port_EnableClocks(uint32 Clocks_Mask)
+{
+  SYSCTL_REGCGC2_REG |= Clocks_Mask;
+  while((SYSCTL_PRGPIO_REG & Clocks_Mask) != Clocks_Mask)
+  {
+    /* Wait until the clock of all the used ports is ready */
+  }
+}
+
+#if (PORT_WARM_BOOT == STD_ON)
+/*******************************************************************************
+* Service Name: Port_ImagesChecksum
+* Description: Local function to compute the checksum of the register images of all the ports
+*******************************************************************************/
+STATIC uint32 Port_ImagesChecksum(const Port_PortImageType * Images)
+{
+  uint32 Checksum = 0;
+  
+  for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    const Port_PortImageType * Image_Ptr = &Images[port];
+    const uint32 Words[] = {
+      Image_Ptr->Dir, Image_Ptr->Data, Image_Ptr->Pur, Image_Ptr->Pdr, Image_Ptr->Den,
+      Image_Ptr->Afsel, Image_Ptr->Amsel, Image_Ptr->Pctl,
+      Image_Ptr->Dr2r, Image_Ptr->Dr4r, Image_Ptr->Dr8r, Image_Ptr->Odr, Image_Ptr->Slr,
+      ((uint32)Image_Ptr->Commit << 24) | ((uint32)Image_Ptr->Configured << 16)
+        | ((uint32)Image_Ptr->Dir_Locked << 8) | (uint32)Image_Ptr->Mode_Locked
+    };
+    
+    for(uint8 index = 0; index < (sizeof(Words) / sizeof(Words[0])); index++)
+    {
+      /* Rotate then mix each word, so swapped or shifted fields give a different checksum */
+      Checksum = ((Checksum << 5) | (Checksum >> 27)) ^ Words[index];
+    }
+  }
+  
+  return Checksum;
+}
+
+/*******************************************************************************
+* Service Name: Port_MatchImage
+* Description: Local function to load the RAM shadow of one port from its registers
+*              and check the configured pins against the register image
+*              (the output values are not checked, they are kept over a warm reset)
+*******************************************************************************/
+STATIC boolean Port_MatchImage(uint8 PortNum, const Port_PortImageType * Image_Ptr)
+{
+  volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(PortNum);
+  const Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[PortNum];
+  uint32 Mask = Image_Ptr->Configured;
+  uint32 Pctl_Mask = Port_PinsToPctlMask(Image_Ptr->Configured);
+  boolean match = FALSE;
+  
+  Port_LoadShadow(PortNum);
+  
+  if( ((*(volatile uint32 *)(PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) & Image_Ptr->Commit) == Image_Ptr->Commit)
+   && (((Shadow_Ptr->Dir   ^ Image_Ptr->Dir)   & Mask)      == 0)
+   && (((Shadow_Ptr->Pur   ^ Image_Ptr->Pur)   & Mask)      == 0)
+   && (((Shadow_Ptr->Pdr   ^ Image_Ptr->Pdr)   & Mask)      == 0)
+   && (((Shadow_Ptr->Amsel ^ Image_Ptr->Amsel) & Mask)      == 0)
+   && (((Shadow_Ptr->Afsel ^ Image_Ptr->Afsel) & Mask)      == 0)
+   && (((Shadow_Ptr->Pctl  ^ Image_Ptr->Pctl)  & Pctl_Mask) == 0)
+   && (((Shadow_Ptr->Den   ^ Image_Ptr->Den)   & Mask)      == 0)
+   && (((Shadow_Ptr->Dr2r  ^ Image_Ptr->Dr2r)  & Mask)      == 0)
+   && (((Shadow_Ptr->Dr4r  ^ Image_Ptr->Dr4r)  & Mask)      == 0)
+   && (((Shadow_Ptr->Dr8r  ^ Image_Ptr->Dr8r)  & Mask)      == 0)
+   && (((Shadow_Ptr->Odr   ^ Image_Ptr->Odr)   & Mask)      == 0)
+   && (((Shadow_Ptr->Slr   ^ Image_Ptr->Slr)   & Mask)      == 0) )
+  {
+    match = TRUE;
+  }
+  else
+  {
+    /* Do Nothing ... the port shall be reprogrammed */
+  }
+  
+  return match;
+}
+
+/*******************************************************************************
+* Service Name: Port_CheckWarmBoot
+* Description: Local function to check if the hardware still holds the configuration:
+*              - The no-init record matches the checksum of the register images
+*              - The clocks of the used ports are still enabled
+*              - The configuration registers of each used port match its register image
+*******************************************************************************/
+STATIC boolean Port_CheckWarmBoot(uint32 Checksum, uint32 Clocks_Mask)
+{
+  boolean match = FALSE;
+  
+  if( (Port_WarmBootRecord.Checksum == Checksum) && (Port_WarmBootRecord.Checksum_Inv == ~Checksum)
+   && ((SYSCTL_REGCGC2_REG & Clocks_Mask) == Clocks_Mask) && ((SYSCTL_PRGPIO_REG & Clocks_Mask) == Clocks_Mask) )
+  {
+    match = TRUE;
+    
+    for(uint8 port = 0; (port < PORT_NUMBER_OF_PORTS) && (match == TRUE); port++)
+    {
+      if(Port_PortImage[port].Configured != 0)
+      {
+        match = Port_MatchImage(port, &Port_PortImage[port]);
+      }
+      else
+      {
+        /* Do Nothing ... no pins configured in this port */
+      }
+    }
+  }
+  else
+  {
+    /* Do Nothing ... cold boot or another configuration */
+  }
+  
+  return match;
+}
+#endif
+
 /*******************************************************************************
                           Function Definitions                                   
 *******************************************************************************/
 
-/*******************************************************************************
-* Service Name: Port_Init
-* Service ID[hex]: 0x00
+/*******************************************************************************
+* Service Name: Port_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Setup the pin configuration:
+*              - Setup the pin as Digital GPIO pin
+*              - Setup the direction of the GPIO pin
+*              - Setup the internal resistor for i/p pin
+*              The pins configuration is folded into per-port register images first,
+*              then the clocks are enabled once and each register of each port is written once.
+*              After a warm reset the reprogramming is skipped when the hardware still holds
+*              the configuration (PORT_WARM_BOOT), the output values are then kept unchanged.
+*******************************************************************************/
+void Port_Init(const Port_ConfigType * ConfigPtr )
+{
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* check if the input configuration pointer is not a NULL_PTR */
+  if(ConfigPtr == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+  }
+  else
+  {	
+    /* Do Nothing */
+  }
+#endif
+  
+  port_status = PORT_INITIALIZED;
+  Port_ConfigPtr = ConfigPtr;
+  
+#if (PORT_AHB_APERTURE == STD_ON)
+  /* Move all the GPIO Ports to the AHB aperture before accessing any of their registers */
+  uint32 Hbctl_Mask = 0;
+  
+  for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    Hbctl_Mask |= Gpio_PortDescriptors[port].Sysctl_Mask;
+  }
+  
+  SYSCTL_GPIOHBCTL_REG |= Hbctl_Mask;
+#endif
+  
+  /* Step 1: load the register images of each port */
+  Port_LoadImages(Port_ConfigPtr, Port_PortImage);
+  
+  /* Step 2: enable the clock of all the used ports with one write and wait once until they are ready */
+  uint32 Clocks_Mask = 0;
+  
+  for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+  {
+    if(Port_PortImage[port].Configured != 0)
+    {
+      Clocks_Mask |= Gpio_PortDescriptors[port].Sysctl_Mask;
+    }
+    else
+    {
+      /* Do Nothing */
+    }
+  }
+  
+  boolean Warm_Boot = FALSE;
+  
+#if (PORT_WARM_BOOT == STD_ON)
+  /* Warm reset: the RAM shadows are loaded from the registers while they are checked */
+  uint32 Checksum = Port_ImagesChecksum(Port_PortImage);
+  Warm_Boot = Port_CheckWarmBoot(Checksum, Clocks_Mask);
+#endif
+  
+  if(FALSE == Warm_Boot)
+  {
+#if (PORT_WARM_BOOT == STD_ON)
+    /* Invalidate the record, a reset during the programming shall not be seen as a warm boot */
+    Port_WarmBootRecord.Checksum_Inv = Checksum;
+#endif
+    
+    Port_EnableClocks(Clocks_Mask);
+    
+    /* Step 3: commit the register images of each port, the RAM shadows follow the written registers */
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      if(Port_PortImage[port].Configured == 0xFF)
+      {
+        Port_WriteImage(port, &Port_PortImage[port]);
+      }
+      else if(Port_PortImage[port].Configured != 0)
+      {
+        /* The bits of the pins not owned by the configuration are kept from the hardware */
+        Port_LoadShadow(port);
+        Port_WriteImage(port, &Port_PortImage[port]);
+      }
+      else
+      {
+        /* Do Nothing ... no pins configured in this port */
+      }
+    }
+    
+#if (PORT_WARM_BOOT == STD_ON)
+    Port_WarmBootRecord.Checksum     = Checksum;
+    Port_WarmBootRecord.Checksum_Inv = ~Checksum;
+#endif
+  }
+  else
+  {
+    /* Do Nothing ... the hardware already holds the configuration */
+  }
+}
+
+/************************************************************************************
+* Service Name: Port_SetPinDirection
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Pin - Port Pin id number
+Direction - Port Pin direction
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function sets the port pin direction
+************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+{
+  boolean error = FALSE;
+  
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect Port Pin ID passed */
+  else if(Pin >= PORT_NUMBER_OF_PINS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_PARAM_PIN);
+    error = TRUE;
+  }
+  /* check if Port Pin not configured as changeable in the active configuration set */
+  else if((Port_PortImage[PORT_PIN_PORT_NUM(&Port_ConfigPtr->Pin[Pin])].Dir_Locked & (1U << PORT_PIN_PIN_NUM(&Port_ConfigPtr->Pin[Pin]))) != 0)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {
+    /* No Action Required */
+  }
+#endif
+  
+  if(FALSE == error)
+  {
+    const Port_ConfigPin * Pin_Ptr = &Port_ConfigPtr->Pin[Pin];
+    uint8 port = PORT_PIN_PORT_NUM(Pin_Ptr);
+    uint8 Pin_Mask = (uint8)(1U << PORT_PIN_PIN_NUM(Pin_Ptr));
+    
+    if((Gpio_PortDescriptors[port].Jtag_Pins & Pin_Mask) != 0)
+    {
+      /* Do Nothing ...  this is the JTAG pins */
+    }
+    else
+    {
+      /* Set or clear the corresponding bit in the GPIODIR register (shadow update and one store) */
+      Port_WriteRegister((volatile uint8 *)PORT_BASE_ADDRESS(port), PORT_DIR_REG_OFFSET, &Port_Shadow[port].Dir,
+                         (Direction == PORT_PIN_OUT) ? Pin_Mask : 0, Pin_Mask);
+    }
+  }
+  else
+  {
+    /* No Action Required */
+  }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_SetPortDirectionMask
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): PortNum - Port number (0 --> PORT_NUMBER_OF_PORTS - 1)
+*                  Pins_Mask - Pins of the port to change (bit n = 1 --> pin n)
+*                  Direction - Port Pins direction
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function sets the direction of many pins of one port with a single GPIODIR store.
+*              All the pins shall be configured with a changeable direction.
+************************************************************************************/
+#if (PORT_SET_PORT_MASK_API == STD_ON)
+void Port_SetPortDirectionMask(uint8 PortNum, uint8 Pins_Mask, Port_PinDirectionType Direction)
+{
+  boolean error = FALSE;
+  
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_DIR_MASK_SID, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect Port number passed */
+  else if(PortNum >= PORT_NUMBER_OF_PORTS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_DIR_MASK_SID, PORT_E_PARAM_PIN);
+    error = TRUE;
+  }
+  /* check if all the Port Pins are configured as changeable (the JTAG pins are never configured) */
+  else if((Pins_Mask & ~(Port_PortImage[PortNum].Configured & ~Port_PortImage[PortNum].Dir_Locked)) != 0)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_DIR_MASK_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {
+    /* No Action Required */
+  }
+#endif
+  
+  if(FALSE == error)
+  {
+    Port_WriteRegister((volatile uint8 *)PORT_BASE_ADDRESS(PortNum), PORT_DIR_REG_OFFSET, &Port_Shadow[PortNum].Dir,
+                       (Direction == PORT_PIN_OUT) ? Pins_Mask : 0, Pins_Mask);
+  }
+  else
+  {
+    /* No Action Required */
+  }
+}
+
+/************************************************************************************
+* Service Name: Port_SetPortModeMask
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): PortNum - Port number (0 --> PORT_NUMBER_OF_PORTS - 1)
+*                  Pins_Mask - Pins of the port to change (bit n = 1 --> pin n)
+*                  Mode - New Port Pins mode to be set
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function sets the mode of many pins of one port with a single store in each of
+*              GPIOAMSEL, GPIOAFSEL, GPIOPCTL and GPIODEN registers.
+*              All the pins shall be configured with a changeable mode.
+************************************************************************************/
+void Port_SetPortModeMask(uint8 PortNum, uint8 Pins_Mask, Port_PinModeType Mode)
+{
+  boolean error = FALSE;
+  
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_MODE_MASK_SID, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect Port number passed */
+  else if(PortNum >= PORT_NUMBER_OF_PORTS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_MODE_MASK_SID, PORT_E_PARAM_PIN);
+    error = TRUE;
+  }
+  /* Check if the Port Pin Mode valid or not for all the Port Pins */
+  else if((Mode > PORT_PIN_MODE_ADC) || ((Pins_Mask & ~Gpio_PortDescriptors[PortNum].Mode_Pins[Mode]) != 0))
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_MODE_MASK_SID, PORT_E_PARAM_INVALID_MODE);
+    error = TRUE;
+  }
+  /* check if all the Port Pins are configured as changeable (the JTAG pins are never configured) */
+  else if((Pins_Mask & ~(Port_PortImage[PortNum].Configured & ~Port_PortImage[PortNum].Mode_Locked)) != 0)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_MODE_MASK_SID, PORT_E_MODE_UNCHANGEABLE);
+    error = TRUE;
+  }
+  else
+  {
+    /* No Action Required */
+  }
+#endif
+  
+  if(FALSE == error)
+  {
+    Port_WriteMode(PortNum, Pins_Mask, Mode);
+  }
+  else
+  {
+    /* No Action Required */
+  }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_SwitchConfigSet
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): ConfigSetId - Index of the configuration set in Port_ConfigSets
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function applies a configuration set (e.g. before entering and after leaving sleep),
+*              only the registers that differ from the current state of each port are written.
+*              All the configuration sets own the same pins (checked by Tools/Port_Generator).
+*              The registers are compared with their RAM shadows, so the pins changed at run time
+*              by the other Port APIs are also moved to the new configuration set.
+*              The direction and mode change permissions of the pins follow the register images
+*              of the active configuration set.
+*              The warm boot record follows the active configuration set (PORT_WARM_BOOT).
+*              The configuration sets are generated with Port_Configuration, they can not be
+*              applied while another configuration is active (Port_Init or Port_ApplyConfig).
+************************************************************************************/
+#if (PORT_SWITCH_CONFIG_SET_API == STD_ON)
+void Port_SwitchConfigSet(Port_ConfigSetIdType ConfigSetId)
+{
+  boolean error = FALSE;
+  
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG_SET_SID, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if incorrect configuration set passed */
+  else if(ConfigSetId >= PORT_NUMBER_OF_CONFIG_SETS)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG_SET_SID, PORT_E_PARAM_CONFIG);
+    error = TRUE;
+  }
+  /* check if the configuration sets belong to the active configuration */
+  else if(Port_ConfigPtr != &Port_Configuration)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIG_SET_SID, PORT_E_PARAM_CONFIG);
+    error = TRUE;
+  }
+  else
+  {
+    /* No Action Required */
+  }
+#endif
+  
+  if(FALSE == error)
+  {
+#if (PORT_WARM_BOOT == STD_ON)
+    /* Invalidate the record, a reset during the switch shall not be seen as a warm boot */
+    Port_WarmBootRecord.Checksum_Inv = Port_WarmBootRecord.Checksum;
+#endif
+    
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      const Port_PortImageType * New_Ptr = &Port_ConfigSets[ConfigSetId][port];
+      
+      if(New_Ptr->Configured != 0)
+      {
+        Port_WriteImageDiff(port, &Port_PortImage[port], New_Ptr);
+        Port_PortImage[port] = *New_Ptr;
+      }
+      else
+      {
+        /* Do Nothing ... no pins configured in this port */
+      }
+    }
+    
+#if (PORT_WARM_BOOT == STD_ON)
+    /* The record now describes the active configuration set */
+    uint32 Checksum = Port_ImagesChecksum(Port_PortImage);
+    Port_WarmBootRecord.Checksum     = Checksum;
+    Port_WarmBootRecord.Checksum_Inv = ~Checksum;
+#endif
+  }
+  else
+  {
+    /* No Action Required */
+  }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Port_ApplyConfig
+* Service ID[hex]: 0x09
 * Sync/Async: Synchronous
 * Reentrancy: Non-Reentrant
-* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (in): OldConfigPtr - Pointer to the post-build configuration currently applied
+*                                 (the one given to Port_Init or to the last Port_ApplyConfig)
+*                  NewConfigPtr - Pointer to the post-build configuration to apply
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the pin configuration:
-*              - Setup the pin as Digital GPIO pin
-*              - Setup the direction of the GPIO pin
-*              - Setup the internal resistor for i/p pin
-*******************************************************************************/
-void Port_Init(const Port_ConfigType * ConfigPtr )
+* Description: Function re-initializes the Port Driver from the differences between two
+*              configurations instead of a full Port_Init:
+*              - Only the clocks of the ports not used by the old configuration are enabled
+*              - The ports owning the same pins in both configurations only get the registers
+*                that differ written, the locked pins are only committed when newly locked
+*              - The ports owning other pins get their whole register image written
+*              The differences are computed from the active register images, which also hold
+*              a configuration set applied by Port_SwitchConfigSet since.
+*              The configuration sets of Port_SwitchConfigSet are only available again once
+*              Port_Configuration is applied back.
+*              The warm boot record follows the new configuration (PORT_WARM_BOOT).
+************************************************************************************/
+#if (PORT_APPLY_CONFIG_API == STD_ON)
+void Port_ApplyConfig(const Port_ConfigType * OldConfigPtr, const Port_ConfigType * NewConfigPtr)
 {
+  boolean error = FALSE;
+  
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-  /* check if the input configuration pointer is not a NULL_PTR */
-  if(ConfigPtr == NULL_PTR)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_PARAM_CONFIG);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_CONFIG_SID, PORT_E_UNINIT);
+    error = TRUE;
+  }
+  /* check if the input configuration pointers are not NULL_PTR */
+  else if((OldConfigPtr == NULL_PTR) || (NewConfigPtr == NULL_PTR))
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_CONFIG_SID, PORT_E_PARAM_CONFIG);
+    error = TRUE;
+  }
+  /* check if the old configuration is the active one */
+  else if(OldConfigPtr != Port_ConfigPtr)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_APPLY_CONFIG_SID, PORT_E_PARAM_CONFIG);
+    error = TRUE;
   }
   else
-  {	
-    /* Do Nothing */
+  {
+    /* No Action Required */
   }
 #endif
   
-  port_status = PORT_INITIALIZED;
-  Port_ConfigPtr = ConfigPtr;
-  
-  for(Port_PinType pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+  if(FALSE == error)
   {
+    Port_PortImageType Old_Images[PORT_NUMBER_OF_PORTS];
+    uint32 Clocks_Mask = 0;
     
-    volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    volatile uint32 delay = 0;
-    
-    switch(Port_ConfigPtr->Pin[pin].port_num)
+    /* The images in the hardware: the old configuration or the configuration set switched to since */
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
     {
-    case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-    break;
-    case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-    break;
-    case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-    break;
-    case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-    break;
-    case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-    break;
-    case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-    break;
+      Old_Images[port] = Port_PortImage[port];
     }
     
-    /* Enable clock for PORT and allow time for clock to start*/
-    SYSCTL_REGCGC2_REG |= (1<<Port_ConfigPtr->Pin[pin].port_num);
-    delay = SYSCTL_REGCGC2_REG;
+#if (PORT_WARM_BOOT == STD_ON)
+    /* Invalidate the record, a reset during the reprogramming shall not be seen as a warm boot */
+    Port_WarmBootRecord.Checksum_Inv = Port_WarmBootRecord.Checksum;
+#endif
+    
+    Port_LoadImages(NewConfigPtr, Port_PortImage);
+    Port_ConfigPtr = NewConfigPtr;
     
-    if( ((Port_ConfigPtr->Pin[pin].port_num == 3) && (Port_ConfigPtr->Pin[pin].pin_num == 7)) || ((Port_ConfigPtr->Pin[pin].port_num == 5) && (Port_ConfigPtr->Pin[pin].pin_num == 0)) ) /* PD7 or PF0 */
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
     {
-      /* Unlock the GPIOCR register */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-      
-      /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
+      if((Port_PortImage[port].Configured != 0) && (Old_Images[port].Configured == 0))
+      {
+        Clocks_Mask |= Gpio_PortDescriptors[port].Sysctl_Mask;
+      }
+      else
+      {
+        /* Do Nothing ... the clock is already enabled or not needed */
+      }
     }
-    else if( (Port_ConfigPtr->Pin[pin].port_num == 2) && (Port_ConfigPtr->Pin[pin].pin_num <= 3)) /* PC0 to PC3 */
+    
+    if(Clocks_Mask != 0)
     {
-      /* Do Nothing ...  this is the JTAG pins */
-      continue;
+      Port_EnableClocks(Clocks_Mask);
     }
     else
     {
-      /* Do Nothing ... No need to unlock the commit register for this pin */
+      /* Do Nothing */
     }
     
-    if(Port_ConfigPtr->Pin[pin].direction == PORT_PIN_OUT)
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      if(Port_PortImage[port].Configured == 0)
       {
-        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-        
-        if(Port_ConfigPtr->Pin[pin].initial_value == PORT_PIN_LEVEL_HIGH)
-        {
-          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-          SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-        }
-        else
-        {
-          /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-          CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-        }
+        /* Do Nothing ... no pins configured in this port */
       }
-      else if(Port_ConfigPtr->Pin[pin].direction == PORT_PIN_IN)
+      else if(Port_PortImage[port].Configured == Old_Images[port].Configured)
       {
-        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-        
-        if(Port_ConfigPtr->Pin[pin].resistor == PULL_UP)
-        {
-          /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-          SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-        }
-        else if(Port_ConfigPtr->Pin[pin].resistor == PULL_DOWN)
+        Port_WriteImageDiff(port, &Old_Images[port], &Port_PortImage[port]);
+      }
+      else
+      {
+        if(Old_Images[port].Configured == 0)
         {
-          /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-          SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
+          /* The RAM shadow of a port not used by the old configuration is loaded from the hardware */
+          Port_LoadShadow(port);
         }
         else
         {
-          /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-          CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-          
-          /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-          CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
+          /* Do Nothing */
         }
+        Port_WriteImage(port, &Port_PortImage[port]);
       }
-      else
-      {
-        /* Do Nothing */
-      }
-    
-    if (Port_ConfigPtr->Pin[pin].initial_mode == PORT_PIN_MODE_DIO)
-    {
-      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Clear the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pin[pin].pin_num * 4));
-            
-      
-      /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-    }
-    else if (Port_ConfigPtr->Pin[pin].initial_mode == PORT_PIN_MODE_ADC)
-    {
-      /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Clear the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pin[pin].pin_num * 4));
-      
-      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-    }
-    else /* Another mode */
-    {
-      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-      CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      
-      /* Set the PMCx bits for this pin */
-      *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Port_ConfigPtr->Pin[pin].initial_mode & 0x0000000F << (Port_ConfigPtr->Pin[pin].pin_num * 4));
-      
-      /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-      SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
     }
+    
+#if (PORT_WARM_BOOT == STD_ON)
+    /* The record now describes the new configuration */
+    uint32 Checksum = Port_ImagesChecksum(Port_PortImage);
+    Port_WarmBootRecord.Checksum     = Checksum;
+    Port_WarmBootRecord.Checksum_Inv = ~Checksum;
+#endif
+  }
+  else
+  {
+    /* No Action Required */
   }
 }
+#endif
 
 /************************************************************************************
-* Service Name: Port_SetPinDirection
-* Service ID[hex]: 0x01
+* Service Name: Port_CheckShadowRegisters
+* Service ID[hex]: 0x0A
 * Sync/Async: Synchronous
-* Reentrancy: Reentrant
-* Parameters (in): Pin - Port Pin id number
-Direction - Port Pin direction
+* Reentrancy: Non-Reentrant
+* Parameters (in): None
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: None
-* Description: Function sets the port pin direction
+* Return value: Std_ReturnType - E_OK: the configuration registers match their RAM shadows
+*                                 E_NOT_OK: at least one configured pin is corrupted
+* Description: Function compares the configuration registers of the pins owned by the
+*              configuration with their RAM shadows to detect corruption.
 ************************************************************************************/
-#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+#if (PORT_SHADOW_CHECK_API == STD_ON)
+Std_ReturnType Port_CheckShadowRegisters(void)
 {
+  Std_ReturnType ret = E_OK;
+  
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* Check if the Driver is initialized before using this function */
   if(port_status == PORT_NOT_INITIALIZED)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_UNINIT);
-  }
-  else
-  {
-    /* Do Nothing */
-  }
-  
-  /* check if incorrect Port Pin ID passed */
-  if(Pin >= PORT_NUMBER_OF_PINS)
-  {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_PARAM_PIN);
-  }
-  else
-  {
-    /* Do Nothing */
-  }
-  
-  /* check if Port Pin not configured as changeable */
-  if(Port_ConfigPtr->Pin[Pin].pin_direction_change == STD_OFF)
-  {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIR_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_CHECK_SHADOW_REGS_SID, PORT_E_UNINIT);
+    ret = E_NOT_OK;
   }
   else
   {
-    /* Do Nothing */
+    /* No Action Required */
   }
 #endif
   
-  volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-  
-  switch(Port_ConfigPtr->Pin[Pin].port_num)
+  for(uint8 port = 0; (port < PORT_NUMBER_OF_PORTS) && (ret == E_OK); port++)
   {
-  case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-  break;
-  case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-  break; 
-  case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-  break;
-  case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-  break; 
-  case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-  break;
-  case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-  break;
-  }
-  
-  if( (Port_ConfigPtr->Pin[Pin].port_num == 2) && (Port_ConfigPtr->Pin[Pin].pin_num <= 3)) /* PC0 to PC3 */
-  {
-    /* Do Nothing ...  this is the JTAG pins */
-    return;
+    volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(port);
+    const Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[port];
+    uint32 Mask = Port_PortImage[port].Configured;
+    uint32 Pctl_Mask = Port_PinsToPctlMask(Port_PortImage[port].Configured);
+    
+    if(Mask == 0)
+    {
+      /* Do Nothing ... no pins configured in this port */
+    }
+    else if( (((*(volatile uint32 *)(PortGpio_Ptr + PORT_DIR_REG_OFFSET)             ^ Shadow_Ptr->Dir)   & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET)         ^ Shadow_Ptr->Pur)   & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET)       ^ Shadow_Ptr->Pdr)   & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) ^ Shadow_Ptr->Amsel) & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET)        ^ Shadow_Ptr->Afsel) & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_CTL_REG_OFFSET)             ^ Shadow_Ptr->Pctl)  & Pctl_Mask) != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET)  ^ Shadow_Ptr->Den)   & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_2MA_REG_OFFSET)       ^ Shadow_Ptr->Dr2r)  & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_4MA_REG_OFFSET)       ^ Shadow_Ptr->Dr4r)  & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_DRIVE_8MA_REG_OFFSET)       ^ Shadow_Ptr->Dr8r)  & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET)      ^ Shadow_Ptr->Odr)   & Mask)      != 0)
+          || (((*(volatile uint32 *)(PortGpio_Ptr + PORT_SLEW_RATE_REG_OFFSET)       ^ Shadow_Ptr->Slr)   & Mask)      != 0) )
+    {
+      ret = E_NOT_OK;
+    }
+    else
+    {
+      /* Do Nothing ... the port matches its shadow */
+    }
   }
   
-  else if(Direction == PORT_PIN_OUT)
-  {
-    /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-  }
-  else if(Direction == PORT_PIN_IN)
-  {
-    /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-  }
-  else
-  {
-    /* Do Nothing */
-  }
+  return ret;
 }
 #endif
 
@@ -302,7 +1142,10 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function refreshes port direction
+* Description: Function refreshes port direction.
+*              Only the pins whose direction is not changeable are refreshed, using the
+*              per-port masks computed by Port_Init: the drifted pins are restored from the
+*              RAM shadow and recorded for diagnostics.
 ************************************************************************************/
 void Port_RefreshPortDirection(void)
 {
@@ -318,53 +1161,88 @@ void Port_RefreshPortDirection(void)
   }
 #endif
   
-  for(Port_PinType pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+  for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
   {
-    volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-    switch(Port_ConfigPtr->Pin[pin].port_num)
-    {
-    case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-    break;
-    case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-    break;
-    case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-    break;
-    case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-    break;
-    case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-    break;
-    case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-    break;
-    }
-    if( (Port_ConfigPtr->Pin[pin].port_num == 2) && (Port_ConfigPtr->Pin[pin].pin_num <= 3)) /* PC0 to PC3 */
-    {
-      /* Do Nothing ...  this is the JTAG pins */
-      continue;
-    }
-    /* Checking if the pin direction is changeable during the run time */
-    if (Port_ConfigPtr->Pin[pin].pin_direction_change == STD_OFF)
+    const Port_PortImageType * Image_Ptr = &Port_PortImage[port];
+    uint8 Drift = 0;
+    
+    /* Checking if the port has pins with unchangeable direction */
+    if(Image_Ptr->Dir_Locked != 0)
     {
-      if(Port_ConfigPtr->Pin[pin].direction == PORT_PIN_OUT)
-      {
-        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      }
-      else if(Port_ConfigPtr->Pin[pin].direction == PORT_PIN_IN)
-      {
-        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , Port_ConfigPtr->Pin[pin].pin_num);
-      }
-      else
+      uint32 Dir = *(volatile uint32 *)((volatile uint8 *)PORT_BASE_ADDRESS(port) + PORT_DIR_REG_OFFSET);
+      
+      /* Pins with unchangeable direction that don't match their RAM shadow */
+      Drift = (uint8)((Dir ^ Port_Shadow[port].Dir) & Image_Ptr->Dir_Locked);
+      
+      /*
+       * Restore only the drifted pins, one bit-band store each from the shadow bit: the bus does an atomic
+       * read-modify-write of that bit, so the GPIODIR value read above is never written back and a direction
+       * set meanwhile by Port_SetPinDirection/Port_SetPortDirectionMask on the other pins is kept
+       */
+      for(uint8 pin = 0; (Drift >> pin) != 0; pin++)
       {
-	/* Do Nothing */
+        if((Drift & (1U << pin)) != 0)
+        {
+          *PORT_BIT_BAND_ALIAS_ADDRESS(PORT_BASE_ADDRESS(port), PORT_DIR_REG_OFFSET, pin) = (Port_Shadow[port].Dir >> pin) & 1U;
+        }
+        else
+        {
+          /* Do Nothing ... the direction of this pin is correct */
+        }
       }
     }
     else
     {
       /* Do Nothing */
     }
+    
+    Port_DirectionDrift[port] = Drift;
+  }
+}
+
+/************************************************************************************
+* Service Name: Port_GetDirectionDrift
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): DriftPtr - Pointer to an array of PORT_NUMBER_OF_PORTS bitmaps where to store
+*                              the pins whose direction drifted (bit n = 1 --> pin n of the port)
+* Return value: None
+* Description: Function to get the pins restored by the last Port_RefreshPortDirection call
+************************************************************************************/
+#if (PORT_DIRECTION_DRIFT_API == STD_ON)
+void Port_GetDirectionDrift(uint8 * DriftPtr)
+{
+  boolean error = FALSE;
+  
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* check if the output pointer is not a NULL_PTR */
+  if(DriftPtr == NULL_PTR)
+  {
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_DIRECTION_DRIFT_SID, PORT_E_PARAM_POINTER);
+    error = TRUE;
+  }
+  else
+  {
+    /* No Action Required */
+  }
+#endif
+  
+  if(FALSE == error)
+  {
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+      DriftPtr[port] = Port_DirectionDrift[port];
+    }
+  }
+  else
+  {
+    /* No Action Required */
   }
 }
+#endif
 
 /************************************************************************************
 * Service Name: Port_GetVersionInfo
@@ -425,118 +1303,157 @@ Mode - New Port Pin mode to be set on port pin
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to get the version info of the GPIO pin
+* Description: Function sets the port pin mode, the GPIOPCTL PMCx bits of the pin are
+*              programmed with the mode for the alternative functions.
 ************************************************************************************/
 #if (PORT_SET_PIN_MODE_API == STD_ON)
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
 {
+  boolean error = FALSE;
+  
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
   /* Check if the Driver is initialized before using this function */
   if(port_status == PORT_NOT_INITIALIZED)
   {
     Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+    error = TRUE;
   }
-  else
-  {
-    /* Do Nothing */
-  }
-  
   /* Check if incorrect Port Pin ID passed */
-  if(Pin >= PORT_NUMBER_OF_PINS)
+  else if(Pin >= PORT_NUMBER_OF_PINS)
   {
     Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+    error = TRUE;
   }
-  else
+  /* Check if the Port Pin Mode valid or not for this pin */
+  else if((Mode > PORT_PIN_MODE_ADC) ||
+          ((Gpio_PortDescriptors[PORT_PIN_PORT_NUM(&Port_ConfigPtr->Pin[Pin])].Mode_Pins[Mode] & (1U << PORT_PIN_PIN_NUM(&Port_ConfigPtr->Pin[Pin]))) == 0))
   {
-    /* Do Nothing */
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+    error = TRUE;
   }
-  
-  /* Check if the Port Pin Mode valid or not*/
-  if(Mode > PORT_PIN_MODE_ADC)
+  /* check if the API called when the mode is unchangeable in the active configuration set */
+  else if((Port_PortImage[PORT_PIN_PORT_NUM(&Port_ConfigPtr->Pin[Pin])].Mode_Locked & (1U << PORT_PIN_PIN_NUM(&Port_ConfigPtr->Pin[Pin]))) != 0)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+    error = TRUE;
   }
   else
   {
-    /* Do Nothing */
+    /* No Action Required */
   }
+#endif
   
-  /* check if the API called when the mode is unchangeable */
-  if(Port_ConfigPtr->Pin[Pin].pin_mode_change == STD_OFF)
+  if(FALSE == error)
   {
-    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+    const Port_ConfigPin * Pin_Ptr = &Port_ConfigPtr->Pin[Pin];
+    
+    uint8 Pin_Mask = (uint8)(1U << PORT_PIN_PIN_NUM(Pin_Ptr));
+    
+    if((Gpio_PortDescriptors[PORT_PIN_PORT_NUM(Pin_Ptr)].Jtag_Pins & Pin_Mask) != 0)
+    {
+      /* Do Nothing ...  this is the JTAG pins */
+    }
+    else
+    {
+      Port_WriteMode(PORT_PIN_PORT_NUM(Pin_Ptr), Pin_Mask, Mode);
+    }
   }
   else
   {
-    /* Do Nothing */
+    /* No Action Required */
   }
+}
 #endif
+
+/************************************************************************************
+* Service Name: Port_SetPinDrive
+* Service ID[hex]: 0x0B
+* Sync/Async: Synchronous
+* Reentrancy: Non-Reentrant
+* Parameters (in): Pin - Port Pin id number
+*                  Drive - Output drive strength (2, 4 or 8 mA)
+*                  SlewRate - Slew rate control (only with the 8 mA drive)
+*                  OpenDrain - Open drain output (e.g. for wired-AND buses)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function sets the output stage of the port pin with one store in each of
+*              GPIOODR, the selected GPIODRxR and GPIOSLR registers
+*              (setting a bit in one GPIODRxR register clears it in the two others).
+*              The slew rate control is only set with the 8 mA drive.
+************************************************************************************/
+#if (PORT_SET_PIN_DRIVE_API == STD_ON)
+void Port_SetPinDrive(Port_PinType Pin, Port_PinDriveType Drive, boolean SlewRate, boolean OpenDrain)
+{
+  boolean error = FALSE;
   
-  volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-  
-  switch(Port_ConfigPtr->Pin[Pin].port_num)
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+  /* Check if the Driver is initialized before using this function */
+  if(port_status == PORT_NOT_INITIALIZED)
   {
-  case  0: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-  break;
-  case  1: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-  break;
-  case  2: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-  break;
-  case  3: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-  break;
-  case  4: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-  break;
-  case  5: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-  break;
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_UNINIT);
+    error = TRUE;
   }
-  
-  if( (Port_ConfigPtr->Pin[Pin].port_num == 2) && (Port_ConfigPtr->Pin[Pin].pin_num <= 3) ) /* PC0 to PC3 */
+  /* check if incorrect Port Pin ID passed */
+  else if(Pin >= PORT_NUMBER_OF_PINS)
   {
-    /* Do Nothing ...  this is the JTAG pins */
-    return;
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_PARAM_PIN);
+    error = TRUE;
   }
-  
-  if (Mode == PORT_PIN_MODE_DIO)
+  /* check the drive strength, the slew rate control is only available with the 8 mA drive */
+  else if((Drive > PORT_PIN_DRIVE_8MA) || ((SlewRate == TRUE) && (Drive != PORT_PIN_DRIVE_8MA)))
   {
-    /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Clear the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
-    
-    /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
+    Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DRIVE_SID, PORT_E_PARAM_INVALID_DRIVE);
+    error = TRUE;
   }
-  else if (Mode == PORT_PIN_MODE_ADC)
+  else
   {
-    /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Enable Alternative function for this pin by setting the corresponding bit in GPIOAFSEL register */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Clear the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
-    
-    /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
+    /* No Action Required */
   }
-  else /* Another mode */
+#endif
+  
+  if(FALSE == error)
   {
-    /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-    CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
-    
-    /* Set the PMCx bits for this pin */
-    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (Mode & 0x0000000F << (Port_ConfigPtr->Pin[Pin].pin_num * 4));
+    const Port_ConfigPin * Pin_Ptr = &Port_ConfigPtr->Pin[Pin];
+    uint8 port = PORT_PIN_PORT_NUM(Pin_Ptr);
+    uint8 Pin_Mask = (uint8)(1U << PORT_PIN_PIN_NUM(Pin_Ptr));
+    volatile uint8 * PortGpio_Ptr = (volatile uint8 *)PORT_BASE_ADDRESS(port);
+    Port_ShadowRegsType * Shadow_Ptr = &Port_Shadow[port];
     
-    /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-    SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , Port_ConfigPtr->Pin[Pin].pin_num);
+    if((Gpio_PortDescriptors[port].Jtag_Pins & Pin_Mask) != 0)
+    {
+      /* Do Nothing ...  this is the JTAG pins */
+    }
+    else
+    {
+      Port_WriteRegister(PortGpio_Ptr, PORT_OPEN_DRAIN_REG_OFFSET, &Shadow_Ptr->Odr, (OpenDrain == TRUE) ? Pin_Mask : 0, Pin_Mask);
+      
+      /* Only the selected drive register is written, the hardware clears the pin in the two others */
+      Shadow_Ptr->Dr2r &= ~(uint32)Pin_Mask;
+      Shadow_Ptr->Dr4r &= ~(uint32)Pin_Mask;
+      Shadow_Ptr->Dr8r &= ~(uint32)Pin_Mask;
+      
+      if(Drive == PORT_PIN_DRIVE_8MA)
+      {
+        Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_8MA_REG_OFFSET, &Shadow_Ptr->Dr8r, Pin_Mask, Pin_Mask);
+      }
+      else if(Drive == PORT_PIN_DRIVE_4MA)
+      {
+        Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_4MA_REG_OFFSET, &Shadow_Ptr->Dr4r, Pin_Mask, Pin_Mask);
+      }
+      else
+      {
+        Port_WriteRegister(PortGpio_Ptr, PORT_DRIVE_2MA_REG_OFFSET, &Shadow_Ptr->Dr2r, Pin_Mask, Pin_Mask);
+      }
+      
+      /* The slew rate control is cleared whenever the 8 mA drive is not selected, even without DET */
+      Port_WriteRegister(PortGpio_Ptr, PORT_SLEW_RATE_REG_OFFSET, &Shadow_Ptr->Slr,
+                         ((SlewRate == TRUE) && (Drive == PORT_PIN_DRIVE_8MA)) ? Pin_Mask : 0, Pin_Mask);
+    }
+  }
+  else
+  {
+    /* No Action Required */
   }
 }
-#endif
\ No newline at end of file
+#endif
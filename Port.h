@@ -90,6 +90,9 @@
 
 /* APIs called with a NULL Pointer, Error shall be reported*/
 #define PORT_E_PARAM_POINTER             ((uint8)0x10)
+
+/* API Port_SetPinDrive service called with invalid drive strength or slew rate */
+#define PORT_E_PARAM_INVALID_DRIVE       ((uint8)0x11)
    
 /*******************************************************************************
                               API Service Id 
@@ -109,6 +112,27 @@
 /*API service ID for Port_SetPinMode function*/
 #define PORT_SET_PIN_MODE_SID              (uint8)0x04   
 
+/*API service ID for Port_GetDirectionDrift function*/
+#define PORT_GET_DIRECTION_DRIFT_SID       (uint8)0x05
+
+/*API service ID for Port_SetPortDirectionMask function*/
+#define PORT_SET_PORT_DIR_MASK_SID         (uint8)0x06
+
+/*API service ID for Port_SetPortModeMask function*/
+#define PORT_SET_PORT_MODE_MASK_SID        (uint8)0x07
+
+/*API service ID for Port_SwitchConfigSet function*/
+#define PORT_SWITCH_CONFIG_SET_SID         (uint8)0x08
+
+/*API service ID for Port_ApplyConfig function*/
+#define PORT_APPLY_CONFIG_SID              (uint8)0x09
+
+/*API service ID for Port_CheckShadowRegisters function*/
+#define PORT_CHECK_SHADOW_REGS_SID         (uint8)0x0A
+
+/*API service ID for Port_SetPinDrive function*/
+#define PORT_SET_PIN_DRIVE_SID             (uint8)0x0B
+
 /*******************************************************************************
                               Module Data Types                              
 *******************************************************************************/
@@ -125,12 +149,21 @@ typedef enum
 /* Description: Different port pin modes */
 typedef uint8 Port_PinModeType;
 
+/* Description: Index of a configuration set in Port_ConfigSets */
+typedef uint8 Port_ConfigSetIdType;
+
 /* Description: Port Pin Level value from Port pin list */
 typedef enum
 {
 	PORT_PIN_LEVEL_LOW,PORT_PIN_LEVEL_HIGH
 }Port_PinLevelValue;
 
+/* Description: Enum to hold the output drive strength of PIN (GPIODR2R, GPIODR4R or GPIODR8R) */
+typedef enum
+{
+    PORT_PIN_DRIVE_2MA,PORT_PIN_DRIVE_4MA,PORT_PIN_DRIVE_8MA
+}Port_PinDriveType;
+
 /* Description: Enum to hold internal resistor type for PIN */
 typedef enum
 {
@@ -162,22 +195,93 @@ typedef enum
  *      6. the initial port pin mode
  *      7. the changing of the pin direction
  *      8. the changing of the pin mode
+ *      9. the output drive strength --> 2, 4 or 8 mA
+ *     10. the slew rate control (only with the 8 mA drive)
+ *     11. the open drain output
+ * The fields are packed in bit-fields so each pin takes 4 bytes of flash, the members keep
+ * their names and order so the configuration initializers stay unchanged. Use the PORT_PIN_xxx accessor
+ * macros below to read them back with their original types. The last 3 fields may be omitted
+ * from an initializer: 2 mA drive, no slew rate control and push-pull output.
  */
 typedef struct 
 {
-    uint8 port_num; 
-    uint8 pin_num; 
-    Port_PinDirectionType direction;
-    Port_InternalResistor resistor;
-    Port_PinLevelValue initial_value;
-    Port_PinInitialMode initial_mode;
-    boolean pin_direction_change;
-    boolean pin_mode_change;
+    uint16 port_num             : 3;  /* 0 --> 5 */
+    uint16 pin_num              : 3;  /* 0 --> 7 */
+    uint16 direction            : 1;  /* Port_PinDirectionType */
+    uint16 resistor             : 2;  /* Port_InternalResistor */
+    uint16 initial_value        : 1;  /* Port_PinLevelValue */
+    uint16 initial_mode         : 4;  /* Port_PinInitialMode : DIO, ALT1 --> ALT14 or ADC */
+    uint16 pin_direction_change : 1;  /* boolean */
+    uint16 pin_mode_change      : 1;  /* boolean */
+    uint16 drive                : 2;  /* Port_PinDriveType */
+    uint16 slew_rate            : 1;  /* boolean */
+    uint16 open_drain           : 1;  /* boolean */
 }Port_ConfigPin;
 
+/* Accessors of the packed pin configuration fields */
+#define PORT_PIN_PORT_NUM(PIN_PTR)          ((uint8)(PIN_PTR)->port_num)
+#define PORT_PIN_PIN_NUM(PIN_PTR)           ((uint8)(PIN_PTR)->pin_num)
+#define PORT_PIN_DIRECTION(PIN_PTR)         ((Port_PinDirectionType)(PIN_PTR)->direction)
+#define PORT_PIN_RESISTOR(PIN_PTR)          ((Port_InternalResistor)(PIN_PTR)->resistor)
+#define PORT_PIN_INITIAL_VALUE(PIN_PTR)     ((Port_PinLevelValue)(PIN_PTR)->initial_value)
+#define PORT_PIN_INITIAL_MODE(PIN_PTR)      ((Port_PinInitialMode)(PIN_PTR)->initial_mode)
+#define PORT_PIN_DIRECTION_CHANGE(PIN_PTR)  ((boolean)(PIN_PTR)->pin_direction_change)
+#define PORT_PIN_MODE_CHANGE(PIN_PTR)       ((boolean)(PIN_PTR)->pin_mode_change)
+#define PORT_PIN_DRIVE(PIN_PTR)             ((Port_PinDriveType)(PIN_PTR)->drive)
+#define PORT_PIN_SLEW_RATE(PIN_PTR)         ((boolean)(PIN_PTR)->slew_rate)
+#define PORT_PIN_OPEN_DRAIN(PIN_PTR)        ((boolean)(PIN_PTR)->open_drain)
+
+/* Description: Structure to hold the register images of one GPIO Port folded from its pins configuration */
+typedef struct
+{
+    uint32 Dir;
+    uint32 Data;
+    uint32 Pur;
+    uint32 Pdr;
+    uint32 Den;
+    uint32 Afsel;
+    uint32 Amsel;
+    uint32 Pctl;
+    uint32 Dr2r;
+    uint32 Dr4r;
+    uint32 Dr8r;
+    uint32 Odr;
+    uint32 Slr;
+    uint8 Commit;      /* Locked pins that need the GPIOCR register to be committed */
+    uint8 Configured;  /* Pins owned by the configuration */
+    uint8 Dir_Locked;  /* Pins with unchangeable direction, refreshed by Port_RefreshPortDirection */
+    uint8 Mode_Locked; /* Pins with unchangeable mode */
+}Port_PortImageType;
+
+/* Description: RAM shadow of the configuration registers of one GPIO Port */
+typedef struct
+{
+    uint32 Dir;
+    uint32 Pur;
+    uint32 Pdr;
+    uint32 Den;
+    uint32 Afsel;
+    uint32 Amsel;
+    uint32 Pctl;
+    uint32 Dr2r;
+    uint32 Dr4r;
+    uint32 Dr8r;
+    uint32 Odr;
+    uint32 Slr;
+}Port_ShadowRegsType;
+
+/* Description: Record of the configuration programmed by Port_Init, kept over a warm reset */
+typedef struct
+{
+    uint32 Checksum;     /* Checksum of the port images programmed by Port_Init */
+    uint32 Checksum_Inv; /* Inverted checksum, the record is only valid when both match */
+}Port_WarmBootRecordType;
+
 typedef struct
 {
   Port_ConfigPin Pin[PORT_NUMBER_OF_PINS];
+  /* Register images precomputed by Tools/Port_Generator (NULL_PTR --> folded at run time by Port_Init) */
+  const Port_PortImageType * Images;
 }Port_ConfigType;  
 
 /*******************************************************************************
@@ -196,6 +300,32 @@ void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction);
 void Port_RefreshPortDirection(void);
 
 
+#if (PORT_DIRECTION_DRIFT_API == STD_ON)
+void Port_GetDirectionDrift(uint8 * DriftPtr);
+#endif
+
+
+#if (PORT_SET_PORT_MASK_API == STD_ON)
+void Port_SetPortDirectionMask(uint8 PortNum, uint8 Pins_Mask, Port_PinDirectionType Direction);
+void Port_SetPortModeMask(uint8 PortNum, uint8 Pins_Mask, Port_PinModeType Mode);
+#endif
+
+
+#if (PORT_SWITCH_CONFIG_SET_API == STD_ON)
+void Port_SwitchConfigSet(Port_ConfigSetIdType ConfigSetId);
+#endif
+
+
+#if (PORT_APPLY_CONFIG_API == STD_ON)
+void Port_ApplyConfig(const Port_ConfigType * OldConfigPtr, const Port_ConfigType * NewConfigPtr);
+#endif
+
+
+#if (PORT_SHADOW_CHECK_API == STD_ON)
+Std_ReturnType Port_CheckShadowRegisters(void);
+#endif
+
+
 #if (PORT_VERSION_INFO_API == STD_ON)
 void Port_GetVersionInfo(Std_VersionInfoType *Versioninfo );
 #endif
@@ -205,6 +335,11 @@ void Port_GetVersionInfo(Std_VersionInfoType *Versioninfo );
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
 #endif
 
+
+#if (PORT_SET_PIN_DRIVE_API == STD_ON)
+void Port_SetPinDrive(Port_PinType Pin, Port_PinDriveType Drive, boolean SlewRate, boolean OpenDrain);
+#endif
+
 /*******************************************************************************
                          External Variables                                    
 *******************************************************************************/
@@ -212,4 +347,7 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
 /* Post build structure used with Port_Init API */
 extern const Port_ConfigType Port_Configuration;
 
+/* Register images of each configuration set of Port_Configuration, indexed by the PortConf_xxx_CONFIG_SET_ID */
+extern const Port_PortImageType * const Port_ConfigSets[PORT_NUMBER_OF_CONFIG_SETS];
+
 #endif /* PORT_H */
@@ -38,9 +38,51 @@
 /* Pre-compile option for presence of Port_SetPinMode API */
 #define PORT_SET_PIN_MODE_API		     (STD_ON)
 
+/* Pre-compile option for presence of Port_GetDirectionDrift API */
+#define PORT_DIRECTION_DRIFT_API             (STD_ON)
+
+/* Pre-compile option for presence of Port_SetPortDirectionMask and Port_SetPortModeMask APIs */
+#define PORT_SET_PORT_MASK_API               (STD_ON)
+
+/* Pre-compile option for presence of Port_SwitchConfigSet API */
+#define PORT_SWITCH_CONFIG_SET_API           (STD_ON)
+
+/* Pre-compile option for presence of Port_ApplyConfig API */
+#define PORT_APPLY_CONFIG_API                (STD_ON)
+
+/* Pre-compile option for presence of Port_CheckShadowRegisters API */
+#define PORT_SHADOW_CHECK_API                (STD_ON)
+
+/* Pre-compile option for presence of Port_SetPinDrive API */
+#define PORT_SET_PIN_DRIVE_API               (STD_ON)
+
+/*
+ * Pre-compile option for the warm boot path of Port_Init:
+ * the configuration programmed by Port_Init is recorded in no-init RAM, after a warm reset
+ * Port_Init skips the reprogramming when the record and the registers still match the configuration
+ */
+#define PORT_WARM_BOOT                       (STD_ON)
+
+/*
+ * Pre-compile option for the GPIO aperture used by the Port Driver:
+ * STD_OFF --> legacy APB aperture, STD_ON --> AHB aperture (selected in GPIOHBCTL by Port_Init).
+ * DIO_AHB_APERTURE in Dio_Cfg.h shall have the same value (checked in Gpio_Ports.c).
+ */
+#define PORT_AHB_APERTURE                    (STD_OFF)
+
 /* Number of Pins */
 #define PORT_NUMBER_OF_PINS		       (43U)   
 
+/* Number of Ports */
+#define PORT_NUMBER_OF_PORTS		       (6U)
+
+/* Number of the configuration sets generated in Port_PBcfg.c (the base configuration is the set 0) */
+#define PORT_NUMBER_OF_CONFIG_SETS             (2U)
+
+/* Configuration Set Index */
+#define PortConf_DEFAULT_CONFIG_SET_ID         (0U)
+#define PortConf_SLEEP_CONFIG_SET_ID           (1U)
+
 /*Ports*/
 #define PORT_A					(0U)
 #define PORT_B					(1U)
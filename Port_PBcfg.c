@@ -5,6 +5,7 @@
  * File Name: Port_PBcfg.c
  *
  * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_Generator from the pin description file ... do not edit.
  *
  * Author: Abdelrahman Adel
  ******************************************************************************/
@@ -39,61 +40,96 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
+/* The number of the described pins shall match the Pre-Compile configuration */
+typedef char Port_PinsCountCheck[(PORT_NUMBER_OF_PINS == 43U) ? 1 : -1];
+
+/* Register images of each port precomputed from the pins configuration, used by the Port_Init fast path */
+STATIC const Port_PortImageType Port_ConfigurationImages[PORT_NUMBER_OF_PORTS] = {
+                /*   DIR    ,   DATA   ,   PUR    ,   PDR    ,   DEN    ,  AFSEL   ,  AMSEL   ,   PCTL    ,   DR2R   ,   DR4R   ,   DR8R   ,   ODR    ,   SLR    , COMMIT , CONFIGURED , DIR LOCKED , MODE LOCKED */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xFF       , 0x00       , 0x00 }, /* PORTA */
+                { 0x000000F0, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xFF       , 0x00       , 0x00 }, /* PORTB */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000F0, 0x00000000, 0x00000000, 0x00000000, 0x000000F0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xF0       , 0x00       , 0x00 }, /* PORTC */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80 , 0xFF       , 0x00       , 0x00 }, /* PORTD */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0x3F       , 0x00       , 0x00 }, /* PORTE */
+                { 0x00000002, 0x00000000, 0x00000010, 0x00000000, 0x0000001F, 0x00000000, 0x00000000, 0x00000000, 0x0000001F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01 , 0x1F       , 0x12       , 0x00 }  /* PORTF */
+};
+
+/* Register images of the SLEEP configuration set */
+STATIC const Port_PortImageType Port_SLEEP_ConfigSetImages[PORT_NUMBER_OF_PORTS] = {
+                /*   DIR    ,   DATA   ,   PUR    ,   PDR    ,   DEN    ,  AFSEL   ,  AMSEL   ,   PCTL    ,   DR2R   ,   DR4R   ,   DR8R   ,   ODR    ,   SLR    , COMMIT , CONFIGURED , DIR LOCKED , MODE LOCKED */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xFF       , 0x00       , 0x00 }, /* PORTA */
+                { 0x00000000, 0x00000000, 0x00000000, 0x000000F0, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xFF       , 0xF0       , 0x00 }, /* PORTB */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000F0, 0x00000000, 0x00000000, 0x00000000, 0x000000F0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0xF0       , 0x00       , 0x00 }, /* PORTC */
+                { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80 , 0xFF       , 0x00       , 0x00 }, /* PORTD */
+                { 0x00000000, 0x00000000, 0x00000000, 0x0000003F, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00 , 0x3F       , 0x00       , 0x00 }, /* PORTE */
+                { 0x00000002, 0x00000000, 0x00000010, 0x00000000, 0x0000001F, 0x00000000, 0x00000000, 0x00000000, 0x0000001F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01 , 0x1F       , 0x12       , 0x00 }  /* PORTF */
+};
+
+/* Configuration sets used with Port_SwitchConfigSet API, indexed by the PortConf_xxx_CONFIG_SET_ID */
+typedef char Port_ConfigSetsCountCheck[(PORT_NUMBER_OF_CONFIG_SETS == 2U) ? 1 : -1];
+typedef char Port_SLEEP_Check[(PortConf_SLEEP_CONFIG_SET_ID == 1U) ? 1 : -1];
+const Port_PortImageType * const Port_ConfigSets[PORT_NUMBER_OF_CONFIG_SETS] = {
+                Port_ConfigurationImages,
+                Port_SLEEP_ConfigSetImages
+};
+
 /* PB structure used with Port_Init API */
 const Port_ConfigType Port_Configuration = {
-
+              {
                 /***********************************Port A Configuration*************************************/
-                PORT_A , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_A , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-                
+		{PORT_A , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_A , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+
                 /***********************************Port B Configuration*************************************/
-                PORT_B , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_B , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-                
+		{PORT_B , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_4 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_5 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_6 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_B , PIN_7 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+
                 /***********************************Port C Configuration*************************************/
-                PORT_C , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_C , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-                
+		{PORT_C , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_OFF , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF}, /* JTAG pin ... never configured */
+		{PORT_C , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_OFF , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF}, /* JTAG pin ... never configured */
+		{PORT_C , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_OFF , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF}, /* JTAG pin ... never configured */
+		{PORT_C , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_OFF , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF}, /* JTAG pin ... never configured */
+		{PORT_C , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_C , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_C , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_C , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+
                 /***********************************Port D Configuration*************************************/
-                PORT_D , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_D , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-                
+		{PORT_D , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_6 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_D , PIN_7 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+
                 /***********************************Port E Configuration*************************************/
-                PORT_E , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_E , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_E , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_E , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_E , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_E , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-                
+		{PORT_E , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_E , PIN_1 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_E , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_E , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_E , PIN_4 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_E , PIN_5 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+
                 /***********************************Port F Configuration*************************************/
-                PORT_F , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_F , PIN_1 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_F , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_F , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON,
-		PORT_F , PIN_4 , PORT_PIN_IN , PULL_UP , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON
-};
\ No newline at end of file
+		{PORT_F , PIN_0 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_F , PIN_1 , PORT_PIN_OUT , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_F , PIN_2 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_F , PIN_3 , PORT_PIN_IN , OFF , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_ON , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF},
+		{PORT_F , PIN_4 , PORT_PIN_IN , PULL_UP , PORT_PIN_LEVEL_LOW , PORT_PIN_MODE_DIO , STD_OFF , STD_ON , PORT_PIN_DRIVE_2MA , STD_OFF , STD_OFF}
+              },
+              Port_ConfigurationImages
+};
@@ -12,30 +12,53 @@
 #ifndef PORT_REGS_H
 #define PORT_REGS_H
 
+#include "Port_Cfg.h"
+#include "Gpio_Ports.h"
+
 /*******************************************************************************
  *                              Module Definitions                             *
  *******************************************************************************/
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/* Registers base address of a GPIO Port on the selected aperture, from the GPIO Ports description */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define PORT_BASE_ADDRESS(PORT_NUM)       (Gpio_PortDescriptors[(PORT_NUM)].Ahb_Base_Address)
+#else
+#define PORT_BASE_ADDRESS(PORT_NUM)       (Gpio_PortDescriptors[(PORT_NUM)].Apb_Base_Address)
+#endif
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
+#define PORT_DRIVE_2MA_REG_OFFSET         0x500
+#define PORT_DRIVE_4MA_REG_OFFSET         0x504
+#define PORT_DRIVE_8MA_REG_OFFSET         0x508
+#define PORT_OPEN_DRAIN_REG_OFFSET        0x50C
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
+#define PORT_SLEW_RATE_REG_OFFSET         0x518
 #define PORT_DIGITAL_ENABLE_REG_OFFSET    0x51C
 #define PORT_LOCK_REG_OFFSET              0x520
 #define PORT_COMMIT_REG_OFFSET            0x524
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/*
+ * Cortex-M4 peripheral bit-band region: bit 0 of the alias word reads/writes one bit of a GPIO register
+ * with an atomic read-modify-write done by the bus (used to restore single GPIODIR bits)
+ */
+#define PORT_PERIPHERAL_BASE_ADDRESS          0x40000000
+#define PORT_BIT_BAND_ALIAS_BASE_ADDRESS      0x42000000
+#define PORT_BIT_BAND_ALIAS_ADDRESS(BASE,OFFSET,BIT)  ((volatile uint32 *)(PORT_BIT_BAND_ALIAS_BASE_ADDRESS\
+                                                      + (((uint32)(BASE) + (OFFSET) - PORT_PERIPHERAL_BASE_ADDRESS) << 5)\
+                                                      + ((uint32)(BIT) << 2)))
+
 #define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
 
+/* GPIO Peripheral Ready register: bit n = 1 --> Port n is clocked and ready to be accessed */
+#define SYSCTL_PRGPIO_REG         (*((volatile uint32 *)0x400FEA08))
+
+/* GPIO High-Performance Bus Control register: bit n = 1 --> Port n is accessed through the AHB aperture */
+#define SYSCTL_GPIOHBCTL_REG      (*((volatile uint32 *)0x400FE06C))
+
 #endif /* PORT_REGS_H */
@@ -0,0 +1,128 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Aperture_Test.c
+ *
+ * Description: Host test of the GPIO aperture selection: every GPIO register access
+ *              of Port and Dio shall target the aperture selected by PORT_AHB_APERTURE
+ *              and DIO_AHB_APERTURE, and GPIOHBCTL shall be set before the first one.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Sim_Regs.h"
+#include "Det_Stub.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Dio_Static.h"
+
+#define TEST_GPIOHBCTL_ADDRESS         (0x400FE06CU)
+#define TEST_BIT_BAND_BASE             (0x42000000U)
+
+/* Register address targeted by an access (the word behind a bit-band alias address) */
+static uint32 Test_Target(uint32 Address)
+{
+    if(Address >= TEST_BIT_BAND_BASE)
+    {
+        Address = 0x40000000U + (((Address - TEST_BIT_BAND_BASE) >> 5) & ~3U);
+    }
+    return Address;
+}
+
+static boolean Test_IsApb(uint32 Address)
+{
+    return ((Address >= 0x40004000U) && (Address < 0x40008000U)) || ((Address >= 0x40024000U) && (Address < 0x40026000U));
+}
+
+static boolean Test_IsAhb(uint32 Address)
+{
+    return (Address >= 0x40058000U) && (Address < 0x4005E000U);
+}
+
+/* Index of a pin in the Port configuration */
+static Port_PinType Test_PinId(uint8 PortNum, uint8 PinNum)
+{
+    Port_PinType pin;
+
+    for(pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+    {
+        if((PORT_PIN_PORT_NUM(&Port_Configuration.Pin[pin]) == PortNum) && (PORT_PIN_PIN_NUM(&Port_Configuration.Pin[pin]) == PinNum))
+        {
+            break;
+        }
+    }
+    return pin;
+}
+
+int main(void)
+{
+    uint32 index;
+    uint32 apb = 0;
+    uint32 ahb = 0;
+    uint32 first_gpio = SIM_LOG_SIZE;
+    uint32 hbctl = SIM_LOG_SIZE;
+    uint8 drift = 0;
+
+    Sim_Init();
+
+    /* Every Port and Dio API touching the GPIO registers */
+    Sim_StartLog();
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+    Port_SetPinDirection(Test_PinId(PORT_B, PIN_0), PORT_PIN_OUT);
+    Port_SetPinMode(Test_PinId(PORT_B, PIN_0), PORT_PIN_MODE_DIO);
+    Port_SetPinDrive(Test_PinId(PORT_B, PIN_0), PORT_PIN_DRIVE_8MA, TRUE, FALSE);
+    Port_SetPortDirectionMask(PORT_E, 0x03U, PORT_PIN_OUT);
+    Port_SetPortModeMask(PORT_E, 0x03U, PORT_PIN_MODE_DIO);
+    Port_RefreshPortDirection();
+    Port_GetDirectionDrift(&drift);
+    (void)Port_CheckShadowRegisters();
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+    Port_SwitchConfigSet(PortConf_DEFAULT_CONFIG_SET_ID);
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+    (void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Dio_WritePort(PORT_E, 0x3FU);
+    (void)Dio_ReadPort(PORT_E);
+    Dio_MaskedWritePort(PORT_E, 0x00U, 0x0FU);
+    Dio_WriteChannelGroup(DioConf_NIBBLE_BUS_GROUP_PTR, 0x05U);
+    (void)Dio_ReadChannelGroup(DioConf_NIBBLE_BUS_GROUP_PTR);
+    Dio_WriteChannelStatic(LED1, STD_LOW);
+    (void)Dio_ReadChannelStatic(SW1);
+    (void)Dio_FlipChannelStatic(LED1);
+    SIM_CHECK(Sim_StopLog() < SIM_LOG_SIZE);
+    SIM_CHECK(Det_ErrorCount == 0U);
+
+    for(index = 0; index < Sim_LogCount; index++)
+    {
+        uint32 target = Test_Target(Sim_Log[index].Address);
+
+        apb += Test_IsApb(target) ? 1U : 0U;
+        ahb += Test_IsAhb(target) ? 1U : 0U;
+        if((Test_IsApb(target) || Test_IsAhb(target)) && (first_gpio == SIM_LOG_SIZE))
+        {
+            first_gpio = index;
+        }
+        if((Sim_Log[index].Address == TEST_GPIOHBCTL_ADDRESS) && Sim_Log[index].Write && (hbctl == SIM_LOG_SIZE))
+        {
+            hbctl = index;
+        }
+    }
+
+#if (PORT_AHB_APERTURE == STD_ON)
+    /* All the ports are moved to AHB before their first register access */
+    SIM_CHECK(apb == 0U);
+    SIM_CHECK(ahb > 0U);
+    SIM_CHECK(hbctl < first_gpio);
+    SIM_CHECK((Sim_ReadReg(TEST_GPIOHBCTL_ADDRESS) & 0x3FU) == 0x3FU);
+#else
+    SIM_CHECK(ahb == 0U);
+    SIM_CHECK(apb > 0U);
+    SIM_CHECK(hbctl == SIM_LOG_SIZE);
+#endif
+
+    printf("GPIO accesses: %u APB, %u AHB of %u logged\n", (unsigned int)apb, (unsigned int)ahb, (unsigned int)Sim_LogCount);
+    printf("Aperture_Test: %s\n", (Sim_Failures == 0U) ? "PASS" : "FAIL");
+    return (Sim_Failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Det_Stub.c
+ *
+ * Description: Det replacement for the host tests, the reported errors are
+ *              recorded instead of stopping the execution.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Det_Stub.h"
+
+uint32 Det_ErrorCount = 0;
+uint16 Det_LastModuleId = 0;
+uint8 Det_LastApiId = 0;
+uint8 Det_LastErrorId = 0;
+
+Std_ReturnType Det_ReportError( uint16 ModuleId,
+                      uint8 InstanceId,
+                      uint8 ApiId,
+                      uint8 ErrorId )
+{
+    (void)InstanceId;
+    Det_ErrorCount++;
+    Det_LastModuleId = ModuleId;
+    Det_LastApiId = ApiId;
+    Det_LastErrorId = ErrorId;
+    return E_OK;
+}
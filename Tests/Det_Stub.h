@@ -0,0 +1,24 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Det_Stub.h
+ *
+ * Description: Det replacement for the host tests, the reported errors are
+ *              recorded instead of stopping the execution.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef DET_STUB_H
+#define DET_STUB_H
+
+#include "Det.h"
+
+/* Number of reported errors and the last reported error */
+extern uint32 Det_ErrorCount;
+extern uint16 Det_LastModuleId;
+extern uint8 Det_LastApiId;
+extern uint8 Det_LastErrorId;
+
+#endif /* DET_STUB_H */
@@ -0,0 +1,68 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Dio_Bench.c
+ *
+ * Description: Cost of the Dio channel APIs on the host register model:
+ *              executed host instructions and register loads/stores per call.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "Sim_Regs.h"
+#include "Dio.h"
+#include "Dio_Regs.h"
+
+/* PORTF data register through the all pins address (APB only before the aperture switch) */
+#ifdef DIO_PORT_BASE_ADDRESS
+#define BENCH_PORTF_DATA               (DIO_PORT_BASE_ADDRESS(5U) + 0x3FCU)
+#else
+#define BENCH_PORTF_DATA               (0x400253FCU)
+#endif
+
+static void Bench_Print(const char * Name, Sim_CostType Cost)
+{
+    printf("%-28s %6u %6u %6u\n", Name, (unsigned int)Cost.Instructions,
+           (unsigned int)Cost.Loads, (unsigned int)Cost.Stores);
+}
+
+int main(void)
+{
+    Sim_CostType cost;
+    Dio_LevelType level = STD_LOW;
+
+    Sim_Init();
+    Dio_Init(&Dio_Configuration);
+
+    printf("%-28s %6s %6s %6s\n", "Dio API (one call)", "instr", "loads", "stores");
+
+    /* The first call of each API is discarded (cold caches of the host do not change the counts) */
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+    SIM_MEASURE(cost, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH));
+    Bench_Print("Dio_WriteChannel(HIGH)", cost);
+    SIM_MEASURE(cost, Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW));
+    Bench_Print("Dio_WriteChannel(LOW)", cost);
+
+    Sim_WriteReg(BENCH_PORTF_DATA, 0x10U);
+    SIM_MEASURE(cost, level = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX));
+    Bench_Print("Dio_ReadChannel", cost);
+    if(level != STD_HIGH)
+    {
+        printf("FAIL: Dio_ReadChannel returned %u\n", (unsigned int)level);
+        return 1;
+    }
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    SIM_MEASURE(cost, level = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX));
+    Bench_Print("Dio_FlipChannel", cost);
+    if((level != STD_HIGH) || ((Sim_ReadReg(BENCH_PORTF_DATA) & 0x02U) == 0U))
+    {
+        printf("FAIL: Dio_FlipChannel did not set the channel\n");
+        return 1;
+    }
+#endif
+
+    return 0;
+}
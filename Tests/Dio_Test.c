@@ -0,0 +1,254 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Dio_Test.c
+ *
+ * Description: Host tests of the Dio driver on the register model: every port and
+ *              group access shall be one load or one store through the GPIODATA
+ *              address mask, and the pins outside the mask shall keep their levels.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Sim_Regs.h"
+#include "Det_Stub.h"
+#include "Dio.h"
+#include "Dio_Regs.h"
+#include "Dio_Static.h"
+
+/* Address of the DATA register exposing the masked pins of a port */
+#define TEST_DATA_ADDRESS(PORT_NUM, MASK)   (DIO_PORT_BASE_ADDRESS(PORT_NUM) + ((uint32)(MASK) << 2))
+
+/* Level of all the pins of a port in the model */
+#define TEST_PORT_LEVEL(PORT_NUM)           Sim_ReadReg(TEST_DATA_ADDRESS(PORT_NUM, 0xFFU))
+
+/* Address used by the Dio channel APIs for the LED1 channel */
+#if (DIO_BIT_BAND_ACCESS == STD_ON)
+#define TEST_LED1_ADDRESS                   ((uint32)DIO_BIT_BAND_ALIAS_ADDRESS(DIO_PORT_BASE_ADDRESS(DioConf_LED1_PORT_NUM),\
+                                                                        DioConf_LED1_CHANNEL_NUM))
+#else
+#define TEST_LED1_ADDRESS                   TEST_DATA_ADDRESS(DioConf_LED1_PORT_NUM, 1U << DioConf_LED1_CHANNEL_NUM)
+#endif
+
+/* Pins of the LED1 port toggled by the simulated ISR */
+#define TEST_ISR_PINS                       (0x0CU)
+
+static const Dio_ChannelGroupType * const Test_Group = DioConf_NIBBLE_BUS_GROUP_PTR;
+
+/* Instruction boundary at which the simulated ISR runs, and the boundaries seen so far */
+static uint32 Test_IsrStep = 0;
+static uint32 Test_Steps = 0;
+
+/* Simulated ISR: toggles other pins of the LED1 port between two instructions of the driver */
+static void Test_Isr(void)
+{
+    Test_Steps++;
+    if(Test_Steps == Test_IsrStep)
+    {
+        Sim_WriteReg(TEST_DATA_ADDRESS(DioConf_LED1_PORT_NUM, 0xFFU),
+                     TEST_PORT_LEVEL(DioConf_LED1_PORT_NUM) ^ TEST_ISR_PINS);
+    }
+}
+
+static void Test_Port(void)
+{
+    Dio_PortLevelType level;
+
+    /* Dio_WritePort: one store through the all pins address */
+    Sim_StartLog();
+    Dio_WritePort(1, 0xA5U);
+    SIM_CHECK(Sim_StopLog() == 1U);
+    SIM_CHECK((Sim_Log[0].Write == TRUE) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(1, 0xFFU)));
+    SIM_CHECK(TEST_PORT_LEVEL(1) == 0xA5U);
+
+    /* Dio_ReadPort: one load through the all pins address */
+    Sim_StartLog();
+    level = Dio_ReadPort(1);
+    SIM_CHECK(Sim_StopLog() == 1U);
+    SIM_CHECK((Sim_Log[0].Write == FALSE) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(1, 0xFFU)));
+    SIM_CHECK(level == 0xA5U);
+
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+    /* Dio_MaskedWritePort: one store, only the masked pins change */
+    Sim_StartLog();
+    Dio_MaskedWritePort(1, 0x0FU, 0x3CU);
+    SIM_CHECK(Sim_StopLog() == 1U);
+    SIM_CHECK((Sim_Log[0].Write == TRUE) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(1, 0x3CU)));
+    SIM_CHECK(TEST_PORT_LEVEL(1) == 0x8DU);
+#endif
+}
+
+static void Test_Group_Read(void)
+{
+    Dio_PortLevelType level;
+
+    /* The pins outside the group are set, they shall not leak into the group value */
+    Sim_WriteReg(TEST_DATA_ADDRESS(Test_Group->PortIndex, 0xFFU), 0x5FU);
+
+    Sim_StartLog();
+    level = Dio_ReadChannelGroup(Test_Group);
+    SIM_CHECK(Sim_StopLog() == 1U);
+    SIM_CHECK((Sim_Log[0].Write == FALSE) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(Test_Group->PortIndex, Test_Group->mask)));
+    SIM_CHECK(level == 0x05U);
+}
+
+static void Test_Group_Write(void)
+{
+    /* The pins outside the group are set, they shall keep their levels */
+    Sim_WriteReg(TEST_DATA_ADDRESS(Test_Group->PortIndex, 0xFFU), 0x0FU);
+
+    Sim_StartLog();
+    Dio_WriteChannelGroup(Test_Group, 0x0AU);
+    SIM_CHECK(Sim_StopLog() == 1U);
+    SIM_CHECK((Sim_Log[0].Write == TRUE) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(Test_Group->PortIndex, Test_Group->mask)));
+    SIM_CHECK(TEST_PORT_LEVEL(Test_Group->PortIndex) == 0xAFU);
+
+    /* Level bits above the group width are cut by the address mask */
+    Dio_WriteChannelGroup(Test_Group, 0x13U);
+    SIM_CHECK(TEST_PORT_LEVEL(Test_Group->PortIndex) == 0x3FU);
+}
+
+static void Test_Channel(void)
+{
+    uint32 portf = DioConf_LED1_PORT_NUM;
+
+    Sim_WriteReg(TEST_DATA_ADDRESS(portf, 0xFFU), 0xEDU);
+
+    /* One store through the channel aperture (or bit-band alias), the other pins are kept */
+    Sim_StartLog();
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+    SIM_CHECK((Sim_StopLog() == 1U) && (Sim_Log[0].Write == TRUE) && (Sim_Log[0].Address == TEST_LED1_ADDRESS));
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0xEFU);
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0xEDU);
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    /* One load and one store through the channel address */
+    Sim_StartLog();
+    SIM_CHECK(Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX) == STD_HIGH);
+    SIM_CHECK((Sim_StopLog() == 2U) && (Sim_LogReads() == 1U) && (Sim_Log[1].Address == TEST_LED1_ADDRESS));
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0xEFU);
+    SIM_CHECK(Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX) == STD_LOW);
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0xEDU);
+#endif
+
+    SIM_CHECK(Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX) == STD_LOW);
+    Sim_WriteReg(TEST_DATA_ADDRESS(portf, 0xFFU), 0x10U);
+    SIM_CHECK(Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX) == STD_HIGH);
+}
+
+/* Flip of the LED1 channel through the compile-time accessor */
+static Dio_LevelType Test_FlipStatic(Dio_ChannelType ChannelId)
+{
+    (void)ChannelId;
+    return Dio_FlipChannelStatic(LED1);
+}
+
+static void Test_Static(void)
+{
+    uint32 portf = DioConf_LED1_PORT_NUM;
+
+    Sim_WriteReg(TEST_DATA_ADDRESS(portf, 0xFFU), 0x11U);
+
+    /* One store through the channel aperture */
+    Sim_StartLog();
+    Dio_WriteChannelStatic(LED1, STD_HIGH);
+    SIM_CHECK((Sim_StopLog() == 1U) && (Sim_Log[0].Address == TEST_DATA_ADDRESS(portf, 0x02U)));
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0x13U);
+
+    /* One load and one store through the channel aperture */
+    Sim_StartLog();
+    SIM_CHECK(Dio_FlipChannelStatic(LED1) == STD_LOW);
+    SIM_CHECK((Sim_StopLog() == 2U) && (Sim_LogReads() == 1U));
+    SIM_CHECK((Sim_Log[0].Address == TEST_DATA_ADDRESS(portf, 0x02U)) && (Sim_Log[1].Address == TEST_DATA_ADDRESS(portf, 0x02U)));
+    SIM_CHECK(TEST_PORT_LEVEL(portf) == 0x11U);
+    SIM_CHECK(Dio_FlipChannelStatic(LED1) == STD_HIGH);
+    SIM_CHECK(Dio_ReadChannelStatic(LED1) == STD_HIGH);
+    SIM_CHECK(Dio_ReadChannelStatic(SW1) == STD_HIGH);
+}
+
+/* Run the ISR at every instruction boundary of a flip: the flip and the ISR updates shall both survive */
+static void Test_Flip_Interleaving(Dio_LevelType (*Flip)(Dio_ChannelType))
+{
+    uint32 portf = DioConf_LED1_PORT_NUM;
+    uint32 before;
+    uint32 fired = 0;
+    Dio_LevelType level;
+
+    Sim_WriteReg(TEST_DATA_ADDRESS(portf, 0xFFU), 0x00U);
+    Sim_SetStepHook(Test_Isr);
+    for(Test_IsrStep = 1; ; Test_IsrStep++)
+    {
+        before = TEST_PORT_LEVEL(portf);
+        Test_Steps = 0;
+        Sim_StartCount();
+        level = Flip(DioConf_LED1_CHANNEL_ID_INDEX);
+        (void)Sim_StopCount();
+        if(Test_Steps < Test_IsrStep)
+        {
+            /* The call ended before this boundary */
+            break;
+        }
+        fired++;
+
+        /* The channel is flipped, and the pins written by the ISR keep the ISR levels */
+        SIM_CHECK(TEST_PORT_LEVEL(portf) == (before ^ 0x02U ^ TEST_ISR_PINS));
+        SIM_CHECK(level == (((before & 0x02U) != 0U) ? STD_LOW : STD_HIGH));
+    }
+    Sim_SetStepHook(NULL_PTR);
+    SIM_CHECK(fired > 10U);
+}
+
+static void Test_Errors(void)
+{
+    uint32 errors = Det_ErrorCount;
+
+    Sim_StartLog();
+    Dio_WritePort(DIO_NUMBER_OF_PORTS, 0xFFU);
+    (void)Dio_ReadChannelGroup(NULL_PTR);
+    SIM_CHECK(Sim_StopLog() == 0U);
+    SIM_CHECK(Det_ErrorCount == errors + 2U);
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* A channel on a port or a pin not described in Gpio_Ports.c is rejected, the active configuration is kept */
+    Dio_ConfigType bad = Dio_Configuration;
+
+    bad.Channels[0].Port_Num = GPIO_NUMBER_OF_PORTS;
+    Det_LastErrorId = 0;
+    Sim_StartLog();
+    Dio_Init(&bad);
+    SIM_CHECK((Sim_StopLog() == 0U) && (Det_LastErrorId == DIO_E_PARAM_CONFIG));
+
+    /* LED1 is on PORTF, which has 5 pins */
+    bad = Dio_Configuration;
+    bad.Channels[0].Ch_Num = 5U;
+    Det_LastErrorId = 0;
+    Dio_Init(&bad);
+    SIM_CHECK(Det_LastErrorId == DIO_E_PARAM_CONFIG);
+
+    Sim_StartLog();
+    Dio_WriteChannel(0U, STD_LOW);
+    SIM_CHECK((Sim_StopLog() == 1U) && (Sim_Log[0].Address == TEST_LED1_ADDRESS));
+#endif
+}
+
+int main(void)
+{
+    Sim_Init();
+    Dio_Init(&Dio_Configuration);
+
+    Test_Port();
+    Test_Group_Read();
+    Test_Group_Write();
+    Test_Channel();
+    Test_Static();
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    Test_Flip_Interleaving(Dio_FlipChannel);
+#endif
+    Test_Flip_Interleaving(Test_FlipStatic);
+    Test_Errors();
+
+    printf("Dio_Test: %s\n", (Sim_Failures == 0U) ? "PASS" : "FAIL");
+    return (Sim_Failures == 0U) ? 0 : 1;
+}
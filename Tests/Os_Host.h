@@ -0,0 +1,33 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Host.h
+ *
+ * Description: Host replacements of the core instructions and of the DWT cycle
+ *              counter used by the Os Scheduler (forced in front of every source
+ *              of Os_Test). The interrupts, the sleep and the cycle counter are
+ *              simulated by Os_Test on the SysTick of the register model.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef OS_HOST_H
+#define OS_HOST_H
+
+#include "Std_Types.h"
+
+/* Virtual DWT cycle counter: counts the running clocks, stopped while sleeping in WFI */
+extern volatile uint32 Os_Host_Cycles;
+#define OS_PROFILE_CYCLE_COUNT()   (Os_Host_Cycles)
+
+/* PRIMASK and WFI of the simulated core */
+void Os_Host_EnableInterrupts(void);
+void Os_Host_DisableInterrupts(void);
+void Os_Host_WaitForInterrupt(void);
+
+#define Enable_Interrupts()        Os_Host_EnableInterrupts()
+#define Disable_Interrupts()       Os_Host_DisableInterrupts()
+#define Wait_For_Interrupt()       Os_Host_WaitForInterrupt()
+
+#endif /* OS_HOST_H */
@@ -0,0 +1,507 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Os_Test.c
+ *
+ * Description: Host tests of the Os Scheduler with the SysTick driver on the
+ *              register model. The system clock is virtual: the tasks consume
+ *              the clocks of their Load, the scheduler itself takes no time, and
+ *              the SysTick interrupt is delivered when the counter wraps while
+ *              the interrupts are enabled.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include <setjmp.h>
+#include "Sim_Regs.h"
+#include "Os.h"
+#include "App.h"
+#include "Gpt.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* System clock of SysTick_Start (16 MHz) */
+#define TEST_CYCLES_PER_US                  (16U)
+
+/* Clocks of one tick of OS_BASE_TIME ms */
+#define TEST_TICK_CYCLES                    (TEST_CYCLES_PER_US * 1000U * OS_BASE_TIME)
+
+#ifdef OS_TEST_SPREAD_MIX
+/* Task mix where the automatic offsets spread the load: two tasks released every 2 ticks and a task
+ * without a period (never released) */
+const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS] = {
+    /*   Task     , Period,       Offset       , Priority, Load */
+    { Button_Task ,   2   , OS_TASK_OFFSET_AUTO ,    3    ,  50  },
+    { Led_Task    ,   2   , OS_TASK_OFFSET_AUTO ,    2    ,  50  },
+    { App_Task    ,   0   , OS_TASK_OFFSET_AUTO ,    1    ,  40  }
+};
+#elif (OS_TICKLESS == STD_ON)
+/* Task mix with idle ticks between the releases, the SysTick period is stretched over them */
+const Os_TaskConfigType Os_Tasks[OS_NUMBER_OF_TASKS] = {
+    /*   Task     , Period,       Offset       , Priority, Load */
+    { Button_Task ,   6   , OS_TASK_OFFSET_AUTO ,    3    ,  20  },
+    { Led_Task    ,  12   , OS_TASK_OFFSET_AUTO ,    2    ,  10  },
+    { App_Task    ,  24   , OS_TASK_OFFSET_AUTO ,    1    ,  30  }
+};
+#else
+/* The task table of the application */
+#include "Os_Cfg.c"
+#endif
+
+/* SysTick current value register */
+#define TEST_SYSTICK_CURRENT                (0xE000E018U)
+
+/* Clocks from the wrap of the SysTick to the first instruction of its ISR (exception entry) */
+#define TEST_ISR_ENTRY_CYCLES               (12U)
+
+/* SysTick ISR of the Gpt driver */
+void SysTick_Handler(void);
+
+volatile uint32 Os_Host_Cycles = 0;
+
+/* Clocks since the start of the test (running and sleeping) and the end of the current run */
+static uint64 Test_Time = 0;
+static uint64 Test_Start_Time = 0;
+static uint64 Test_End_Time = 0;
+
+/* SysTick wraps away from a whole number of ticks after the start of the Os (time base drift) */
+static uint32 Test_Off_Grid = 0;
+
+/* PRIMASK of the simulated core, and the exit from the scheduler at the end of a run */
+static boolean Test_Masked = TRUE;
+static jmp_buf Test_Exit;
+
+/* Runs of each task of the Os_Tasks table */
+static uint32 Test_Runs[OS_NUMBER_OF_TASKS];
+
+/* SysTick interrupts of the current run, and the load in us run at each tick of the hyperperiod */
+static uint32 Test_Ticks = 0;
+static uint32 Test_Run_Ticks = 0;
+static uint32 Test_Hyperperiod = 1;
+static uint32 Test_Tick_Load[OS_MAX_HYPERPERIOD_TICKS];
+
+/* Clocks added to the next task run (overload) */
+static uint32 Test_Extra_Cycles = 0;
+
+/* Instruction boundary of the scheduler pass at which a tick is forced (0: no forced tick), and the boundaries seen */
+static uint32 Test_Race_Step = 0;
+static uint32 Test_Steps = 0;
+static boolean Test_Counting = FALSE;
+
+/* Wakeup latency: host instructions from the return of WFI to the start of the first task */
+static boolean Test_Latency = FALSE;
+static boolean Test_Latency_Counting = FALSE;
+static uint32 Test_Latency_Min = 0xFFFFFFFFU;
+static uint32 Test_Latency_Max = 0;
+static uint32 Test_Idle_Wakeup_Max = 0;
+
+/* Advance the SysTick by up to Cycles clocks (stopping at a wrap), returns the clocks advanced */
+static uint32 Test_Clock(uint32 Cycles)
+{
+    uint32 step = Sim_SysTickAdvance(Cycles);
+
+    Test_Time += step;
+    if((step != 0U) && (Sim_ReadReg(TEST_SYSTICK_CURRENT) == 0U) &&
+       (((Test_Time - Test_Start_Time) % TEST_TICK_CYCLES) != 0U))
+    {
+        Test_Off_Grid++;
+    }
+    return step;
+}
+
+/* Run the SysTick ISR when its interrupt is pending and not masked */
+static void Test_Interrupt(void)
+{
+    if((Test_Masked == FALSE) && (Sim_SysTickPending() == TRUE))
+    {
+        Sim_SysTickAcknowledge();
+        Test_Ticks++;
+        /* The core runs the exception entry, the SysTick reloads meanwhile */
+        Os_Host_Cycles += Test_Clock(TEST_ISR_ENTRY_CYCLES);
+        SysTick_Handler();
+
+        if((Test_Race_Step != 0U) && (Test_Counting == FALSE))
+        {
+            /* Step the scheduler pass handling the first tick */
+            Test_Counting = TRUE;
+            Sim_StartCount();
+        }
+    }
+}
+
+/* Run the core for Cycles clocks, the interrupts are taken at the clock they become pending */
+static void Test_Advance(uint32 Cycles)
+{
+    while(Cycles != 0U)
+    {
+        uint32 step = Test_Clock(Cycles);
+
+        Os_Host_Cycles += step;
+        Cycles -= step;
+        Test_Interrupt();
+    }
+}
+
+void Os_Host_EnableInterrupts(void)
+{
+    Test_Masked = FALSE;
+    Test_Interrupt();
+}
+
+void Os_Host_DisableInterrupts(void)
+{
+    Test_Masked = TRUE;
+}
+
+/* Sleep until the SysTick interrupt is pending, the cycle counter stops while sleeping */
+void Os_Host_WaitForInterrupt(void)
+{
+    if(Test_Counting == TRUE)
+    {
+        /* End of the stepped scheduler pass */
+        (void)Sim_StopCount();
+        Test_Counting = FALSE;
+        longjmp(Test_Exit, 1);
+    }
+    if(Test_Latency_Counting == TRUE)
+    {
+        /* Wakeup without any task to run */
+        uint32 instructions = Sim_StopCount();
+
+        Test_Latency_Counting = FALSE;
+        Test_Idle_Wakeup_Max = (instructions > Test_Idle_Wakeup_Max) ? instructions : Test_Idle_Wakeup_Max;
+    }
+    if(Test_Time >= Test_End_Time)
+    {
+        longjmp(Test_Exit, 1);
+    }
+    while(Sim_SysTickPending() == FALSE)
+    {
+        (void)Test_Clock(0xFFFFFFFFU);
+    }
+    if(Test_Latency == TRUE)
+    {
+        Test_Latency_Counting = TRUE;
+        Sim_StartCount();
+    }
+}
+
+/* Body of the tasks: the task runs for the clocks of its Load */
+static void Test_RunTask(void (*Task_Ptr)(void))
+{
+    if(Test_Latency_Counting == TRUE)
+    {
+        uint32 instructions = Sim_StopCount();
+
+        Test_Latency_Counting = FALSE;
+        Test_Latency_Min = (instructions < Test_Latency_Min) ? instructions : Test_Latency_Min;
+        Test_Latency_Max = (instructions > Test_Latency_Max) ? instructions : Test_Latency_Max;
+    }
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        if(Os_Tasks[task].Task_Ptr == Task_Ptr)
+        {
+            /* The tasks released at a tick run in the next tick (after its end), an interrupt can end several
+             * ticks in tickless mode, the ticks after the end of the run are not counted */
+            uint32 tick = (uint32)((Test_Time - Test_Start_Time) / TEST_TICK_CYCLES) - 1U;
+            if(tick < Test_Run_Ticks)
+            {
+                Test_Tick_Load[tick % Test_Hyperperiod] += Os_Tasks[task].Load;
+            }
+            uint32 extra = Test_Extra_Cycles;
+
+            Test_Extra_Cycles = 0;
+            Test_Runs[task]++;
+            Test_Advance((Os_Tasks[task].Load * TEST_CYCLES_PER_US) + extra);
+        }
+    }
+}
+
+void Init_Task(void)
+{
+    /* Nothing to initialize */
+}
+
+void Button_Task(void)
+{
+    Test_RunTask(Button_Task);
+}
+
+void Led_Task(void)
+{
+    Test_RunTask(Led_Task);
+}
+
+void App_Task(void)
+{
+    Test_RunTask(App_Task);
+}
+
+/* Ticks of the hyperperiod: least common multiple of the task periods */
+static uint32 Test_GetHyperperiod(void)
+{
+    uint32 hyperperiod = 1;
+
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        uint32 multiple = hyperperiod;
+
+        while((Os_Tasks[task].Period != 0U) && ((multiple % Os_Tasks[task].Period) != 0U))
+        {
+            multiple += hyperperiod;
+        }
+        hyperperiod = multiple;
+    }
+    return hyperperiod;
+}
+
+/* Start the Os and leave the scheduler at its first sleep after Ticks ticks */
+static void Test_Run(uint32 Ticks)
+{
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        Test_Runs[task] = 0;
+    }
+    for(uint32 tick = 0; tick < OS_MAX_HYPERPERIOD_TICKS; tick++)
+    {
+        Test_Tick_Load[tick] = 0;
+    }
+    Test_Hyperperiod = Test_GetHyperperiod();
+    Test_Ticks = 0;
+    Test_Run_Ticks = Ticks;
+    Test_Masked = TRUE;
+    Test_Start_Time = Test_Time;
+    Test_Off_Grid = 0;
+    Test_End_Time = Test_Time + ((uint64)Ticks * TEST_TICK_CYCLES);
+    if(setjmp(Test_Exit) == 0)
+    {
+        Os_start();
+    }
+    Test_Masked = TRUE;
+}
+
+/* The tasks run at their period, profiled with the virtual cycle counter instead of the DWT unit */
+static void Test_Profile(void)
+{
+    Os_TaskProfileType profile;
+    Os_TaskStatsType stats;
+
+    Test_Run(60);
+
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        uint32 cycles = Os_Tasks[task].Load * TEST_CYCLES_PER_US;
+
+        SIM_CHECK(Os_GetTaskProfile(task, &profile) == E_OK);
+        SIM_CHECK(Os_GetTaskStats(task, &stats) == E_OK);
+        if(Os_Tasks[task].Period == 0U)
+        {
+            /* Never released */
+            SIM_CHECK((Test_Runs[task] == 0U) && (profile.Count == 0U) && (stats.Activations == 0U));
+            continue;
+        }
+        SIM_CHECK((Test_Runs[task] >= (60U / Os_Tasks[task].Period) - 1U) && (Test_Runs[task] <= (60U / Os_Tasks[task].Period) + 1U));
+        SIM_CHECK((profile.Count == Test_Runs[task]) && (stats.Activations == Test_Runs[task]));
+        SIM_CHECK((profile.Min_Cycles == cycles) && (profile.Max_Cycles == cycles) && (profile.Mean_Cycles == cycles));
+        SIM_CHECK((stats.Missed_Activations == 0U) && (stats.Overruns == 0U) && (stats.Max_Lateness == 0U));
+        printf("Task %u: %u runs of %u cycles\n", (unsigned int)task, (unsigned int)profile.Count, (unsigned int)profile.Max_Cycles);
+    }
+
+    /* The DWT unit is left untouched when the build provides the cycle source */
+    SIM_CHECK(Sim_ReadReg(0xE000EDFCU) == 0U);
+    SIM_CHECK(Sim_ReadReg(0xE0001000U) == 0U);
+    SIM_CHECK(Os_GetLostTicks() == 0U);
+
+    /* Every tick ends OS_BASE_TIME ms after the previous one */
+    SIM_CHECK(Test_Off_Grid == 0U);
+}
+
+/* Simulated timer: the SysTick wraps at one instruction boundary of the scheduler pass */
+static void Test_RaceTick(void)
+{
+    Test_Steps++;
+    if(Test_Steps == Test_Race_Step)
+    {
+        Sim_WriteReg(TEST_SYSTICK_CURRENT, 1U);
+        Test_Advance(1U);
+    }
+}
+
+/* Only the ticks coming while the scheduler is busy are lost, whatever the instruction they interrupt */
+static void Test_LostTicks(void)
+{
+    uint32 fired = 0;
+    uint32 merged = 0;
+    boolean late;
+    Os_TaskStatsType stats;
+
+    /* A task running for 2.5 ticks: the two ticks coming during the run are handled together */
+    Os_ResetStats();
+    Test_Extra_Cycles = (5U * TEST_TICK_CYCLES) / 2U;
+    Test_Run(10);
+    SIM_CHECK(Os_GetLostTicks() == 1U);
+
+    /* A tick coming at any instruction boundary of a scheduler pass is handled by the next pass */
+    Sim_SetStepHook(Test_RaceTick);
+    for(Test_Race_Step = 1; ; Test_Race_Step++)
+    {
+        Os_ResetStats();
+        Test_Steps = 0;
+        Test_Run(10);
+        if(Test_Steps < Test_Race_Step)
+        {
+            /* The pass ended before this boundary */
+            break;
+        }
+        fired++;
+
+        /* A tick coming before the pass reads the tick count is merged with the first one (back to back
+         * interrupts): the tasks of the first tick then run one tick late. A tick coming after the read
+         * is left pending for the next pass and is not lost. */
+        late = FALSE;
+        for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+        {
+            SIM_CHECK(Os_GetTaskStats(task, &stats) == E_OK);
+            late = (stats.Max_Lateness != 0U) ? TRUE : late;
+        }
+        SIM_CHECK(Os_GetLostTicks() == ((late == TRUE) ? 1U : 0U));
+        merged += (late == TRUE) ? 1U : 0U;
+    }
+    Sim_SetStepHook(NULL_PTR);
+    Test_Race_Step = 0;
+    printf("Forced ticks at %u instruction boundaries of a scheduler pass, %u merged before the read\n",
+           (unsigned int)fired, (unsigned int)merged);
+    SIM_CHECK(fired > 50U);
+}
+
+/* Wakeups from WFI over the hyperperiod and their latency. In tickless mode the SysTick period is stretched
+ * over the idle ticks, the tasks still run at their release tick and the time base does not drift. */
+static void Test_Wakeups(void)
+{
+    Os_TaskStatsType stats;
+    uint32 ticks;
+    uint32 releases = 0;
+
+    Test_Hyperperiod = Test_GetHyperperiod();
+    Os_ResetStats();
+    Test_Latency = TRUE;
+    Test_Run(4U * Test_Hyperperiod);
+    Test_Latency = FALSE;
+    ticks = (uint32)((Test_Time - Test_Start_Time) / TEST_TICK_CYCLES);
+
+    for(uint32 tick = 0; tick < Test_Hyperperiod; tick++)
+    {
+        releases += (Test_Tick_Load[tick] != 0U) ? 1U : 0U;
+    }
+    printf("%u wakeups over %u ticks (%u ticks with a release per hyperperiod of %u ticks)\n",
+           (unsigned int)Os_GetIdleWakeups(), (unsigned int)ticks, (unsigned int)releases, (unsigned int)Test_Hyperperiod);
+    printf("Wakeup to the first task: %u..%u instructions, wakeup without a task: up to %u instructions\n",
+           (unsigned int)Test_Latency_Min, (unsigned int)Test_Latency_Max, (unsigned int)Test_Idle_Wakeup_Max);
+
+    SIM_CHECK(Test_Off_Grid == 0U);
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        if(Os_Tasks[task].Period == 0U)
+        {
+            continue;
+        }
+        SIM_CHECK(Os_GetTaskStats(task, &stats) == E_OK);
+        SIM_CHECK((stats.Missed_Activations == 0U) && (stats.Max_Lateness == 0U));
+        SIM_CHECK((Test_Runs[task] + 1U >= ticks / Os_Tasks[task].Period) && (Test_Runs[task] <= (ticks / Os_Tasks[task].Period) + 1U));
+    }
+#if (OS_TICKLESS == STD_ON)
+    /* A wakeup at each tick with a release only, the SysTick count after it lasts up to the next release */
+    SIM_CHECK(Test_Idle_Wakeup_Max == 0U);
+    SIM_CHECK(Os_GetIdleWakeups() <= ((releases * ticks) / Test_Hyperperiod) + 2U);
+#else
+    SIM_CHECK(Os_GetIdleWakeups() + 1U >= ticks);
+#endif
+}
+
+#if (OS_CPU_LOAD_API == STD_ON)
+/* The CPU load of a tick is its busy cycles over the cycles of the tick, only the DWT source exists with WFI */
+static void Test_CpuLoad(void)
+{
+    Os_CpuLoadType load;
+
+    /* The first tick runs half a tick more, the load is reported when the next tick closes its window */
+    Test_Extra_Cycles = TEST_TICK_CYCLES / 2U;
+    Test_Run(2);
+    SIM_CHECK(Os_GetCpuLoad(OS_CPU_LOAD_DWT, &load) == E_OK);
+    printf("CPU load of a tick with half a tick of extra run: %u%%\n", (unsigned int)load.Tick_Load);
+    SIM_CHECK(load.Tick_Load == 50U);
+#if (OS_IDLE_WFI == STD_ON)
+    SIM_CHECK(Os_GetCpuLoad(OS_CPU_LOAD_IDLE_LOOP, &load) == E_NOT_OK);
+#endif
+}
+#endif
+
+/* Worst tick of a per-tick load report of the hyperperiod */
+static uint32 Test_PrintLoad(const char * Name, const uint32 * Tick_Load)
+{
+    uint32 worst = 0;
+
+    printf("%-22s", Name);
+    for(uint32 tick = 0; tick < Test_Hyperperiod; tick++)
+    {
+        printf(" %4u", (unsigned int)Tick_Load[tick]);
+        worst = (Tick_Load[tick] > worst) ? Tick_Load[tick] : worst;
+    }
+    printf("   worst %u us\n", (unsigned int)worst);
+    return worst;
+}
+
+/* Load run at each tick of the hyperperiod: all the offsets at 0 (before the automatic offsets) against
+ * the offsets chosen by Os_start, measured on the tasks run by the scheduler */
+static void Test_TickLoad(void)
+{
+    uint32 Zero_Load[OS_MAX_HYPERPERIOD_TICKS] = {0};
+    uint32 zero_worst;
+    uint32 auto_worst;
+    uint32 total = 0;
+
+    Test_Hyperperiod = Test_GetHyperperiod();
+    for(uint8 task = 0; task < OS_NUMBER_OF_TASKS; task++)
+    {
+        for(uint32 tick = 0; (Os_Tasks[task].Period != 0U) && (tick < Test_Hyperperiod); tick += Os_Tasks[task].Period)
+        {
+            Zero_Load[tick] += Os_Tasks[task].Load;
+            total += Os_Tasks[task].Load;
+        }
+    }
+
+    /* Five hyperperiods, the load of each tick is the same in every hyperperiod */
+    Test_Run(5U * Test_Hyperperiod);
+    for(uint32 tick = 0; tick < Test_Hyperperiod; tick++)
+    {
+        Test_Tick_Load[tick] /= 5U;
+    }
+
+    printf("Load per tick of the hyperperiod (%u ticks), in us:\n", (unsigned int)Test_Hyperperiod);
+    zero_worst = Test_PrintLoad("  offsets 0", Zero_Load);
+    auto_worst = Test_PrintLoad("  automatic offsets", Test_Tick_Load);
+
+    SIM_CHECK(auto_worst <= zero_worst);
+    /* No tick can be lighter than the mean load of the hyperperiod */
+    SIM_CHECK(auto_worst >= (total + Test_Hyperperiod - 1U) / Test_Hyperperiod);
+#ifdef OS_TEST_SPREAD_MIX
+    /* The two tasks of 2 ticks are released at alternate ticks */
+    SIM_CHECK((zero_worst == 100U) && (auto_worst == 50U));
+#endif
+}
+
+int main(void)
+{
+    Sim_Init();
+
+    Test_Profile();
+    Test_TickLoad();
+    Test_LostTicks();
+    Test_Wakeups();
+#if (OS_CPU_LOAD_API == STD_ON)
+    Test_CpuLoad();
+#endif
+
+    printf("Os_Test: %s\n", (Sim_Failures == 0U) ? "PASS" : "FAIL");
+    return (Sim_Failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Port_Bench.c
+ *
+ * Description: Cost of Port_Init on the host register model: executed host
+ *              instructions and register loads/stores.
+ *              The per-pin APIs are also measured on a pin of each port, their
+ *              cost shall not depend on the port number (descriptor table indexing).
+ *              Define PORT_BENCH_NO_IMAGES to measure a revision older than the
+ *              precomputed port images (SRC_DIR=<exported revision>).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Sim_Regs.h"
+#include "Port.h"
+
+/* The per-port dispatch is measured on the revisions with the GPIO port descriptor table */
+#if defined(__has_include)
+#if __has_include("Gpio_Ports.h") && defined(PORT_SET_PIN_DRIVE_API)
+#include "Gpio_Ports.h"
+#define BENCH_PORT_DISPATCH
+#endif
+#endif
+
+/* APB base addresses of the 6 GPIO Ports and the offsets of their configuration registers */
+static const uint32 Bench_Ports[] = {0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U};
+static const uint32 Bench_Offsets[] = {0x3FCU, 0x400U, 0x420U, 0x500U, 0x504U, 0x508U, 0x50CU, 0x510U,
+                                       0x514U, 0x518U, 0x51CU, 0x524U, 0x528U, 0x52CU};
+
+/* Signature of the GPIO configuration registers, equal signatures --> same programmed state */
+static uint32 Bench_Signature(void)
+{
+    uint32 signature = 2166136261U;
+    uint32 port;
+    uint32 offset;
+
+    for(port = 0; port < sizeof(Bench_Ports) / sizeof(Bench_Ports[0]); port++)
+    {
+        for(offset = 0; offset < sizeof(Bench_Offsets) / sizeof(Bench_Offsets[0]); offset++)
+        {
+            signature = (signature ^ Sim_ReadReg(Bench_Ports[port] + Bench_Offsets[offset])) * 16777619U;
+        }
+    }
+    return signature;
+}
+
+#ifdef BENCH_PORT_DISPATCH
+/* Index of the first pin of a port with a changeable direction (PORT_NUMBER_OF_PINS if none) */
+static Port_PinType Bench_PortPin(uint8 PortNum)
+{
+    Port_PinType pin;
+
+    for(pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+    {
+        const Port_ConfigPin * Pin_Ptr = &Port_Configuration.Pin[pin];
+
+        if((PORT_PIN_PORT_NUM(Pin_Ptr) == PortNum) && (PORT_PIN_DIRECTION_CHANGE(Pin_Ptr) == STD_ON)
+           && ((Gpio_PortDescriptors[PortNum].Jtag_Pins & (1U << PORT_PIN_PIN_NUM(Pin_Ptr))) == 0U))
+        {
+            break;
+        }
+    }
+    return pin;
+}
+#endif
+
+static void Bench_Print(const char * Name, Sim_CostType Cost)
+{
+    printf("%-36s %7u %6u %6u\n", Name, (unsigned int)Cost.Instructions,
+           (unsigned int)Cost.Loads, (unsigned int)Cost.Stores);
+}
+
+int main(void)
+{
+    Sim_CostType cost;
+
+    Sim_Init();
+
+    /* Static size of the pin configuration */
+    printf("Port_ConfigPin: %u bytes, Port_Configuration: %u bytes\n",
+           (unsigned int)sizeof(Port_ConfigPin), (unsigned int)sizeof(Port_Configuration));
+
+    printf("%-36s %7s %6s %6s\n", "Port API (one call)", "instr", "loads", "stores");
+
+    /* From the reset values of the registers */
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    Bench_Print("Port_Init (after power-on reset)", cost);
+
+    /* Again with the registers already programmed (RAM kept, like a warm reset) */
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    Bench_Print("Port_Init (registers kept)", cost);
+
+#ifdef PortConf_SLEEP_CONFIG_SET_ID
+    /* Configuration set switch, only the differing registers are written */
+    SIM_MEASURE(cost, Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID));
+    Bench_Print("Port_SwitchConfigSet (to SLEEP)", cost);
+    SIM_MEASURE(cost, Port_SwitchConfigSet(0U));
+    Bench_Print("Port_SwitchConfigSet (back to base)", cost);
+#endif
+
+#ifndef PORT_BENCH_NO_IMAGES
+    {
+        /* Without the precomputed images Port_Init folds every pin configuration at run time */
+        Port_ConfigType folded = Port_Configuration;
+
+        folded.Images = NULL_PTR;
+        Sim_PowerOnReset();
+        SIM_MEASURE(cost, Port_Init(&folded));
+        Bench_Print("Port_Init (pins folded at run time)", cost);
+    }
+#endif
+
+#ifdef BENCH_PORT_DISPATCH
+    /* Per-pin dispatch on each port: the cost shall be the same for the first and the last port */
+    printf("\n%-36s %7s %7s %7s\n", "Port (pin)", "SetDir", "SetMask", "SetDrv");
+    for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        Port_PinType pin = Bench_PortPin(port);
+        uint8 Pin_Mask = (uint8)(1U << PORT_PIN_PIN_NUM(&Port_Configuration.Pin[pin]));
+        Port_PinDirectionType Direction = PORT_PIN_DIRECTION(&Port_Configuration.Pin[pin]);
+        Sim_CostType dir_cost;
+        Sim_CostType mask_cost;
+        Sim_CostType drive_cost;
+        char name[16];
+
+        if(pin == PORT_NUMBER_OF_PINS)
+        {
+            continue;
+        }
+        SIM_MEASURE(dir_cost, Port_SetPinDirection(pin, Direction));
+        SIM_MEASURE(mask_cost, Port_SetPortDirectionMask(port, Pin_Mask, Direction));
+        SIM_MEASURE(drive_cost, Port_SetPinDrive(pin, PORT_PIN_DRIVE_2MA, FALSE, FALSE));
+        snprintf(name, sizeof(name), "P%c%u", 'A' + port, (unsigned int)PORT_PIN_PIN_NUM(&Port_Configuration.Pin[pin]));
+        printf("%-36s %7u %7u %7u\n", name, (unsigned int)dir_cost.Instructions,
+               (unsigned int)mask_cost.Instructions, (unsigned int)drive_cost.Instructions);
+    }
+#endif
+
+    printf("GPIO register state signature: 0x%08X\n", (unsigned int)Bench_Signature());
+
+    return 0;
+}
@@ -0,0 +1,289 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Port_Test.c
+ *
+ * Description: Host tests of the Port driver on the register model.
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#include "Sim_Regs.h"
+#include "Det_Stub.h"
+#include "Port.h"
+#include "Port_Regs.h"
+
+/* Address of a register of a port */
+#define TEST_REG(PORT_NUM, OFFSET)          (PORT_BASE_ADDRESS(PORT_NUM) + (uint32)(OFFSET))
+
+/* Register stores of a Port_Init keeping the hardware configuration (GPIOHBCTL selection with the AHB aperture) */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define TEST_WARM_INIT_STORES               (1U)
+#else
+#define TEST_WARM_INIT_STORES               (0U)
+#endif
+
+/* Index of a pin in the Port configuration */
+static Port_PinType Test_PinId(uint8 PortNum, uint8 PinNum)
+{
+    Port_PinType pin;
+
+    for(pin = 0; pin < PORT_NUMBER_OF_PINS; pin++)
+    {
+        if((PORT_PIN_PORT_NUM(&Port_Configuration.Pin[pin]) == PortNum) && (PORT_PIN_PIN_NUM(&Port_Configuration.Pin[pin]) == PinNum))
+        {
+            break;
+        }
+    }
+    return pin;
+}
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/* Instruction boundary at which the simulated ISR runs, and the boundaries seen so far */
+static uint32 Test_IsrStep = 0;
+static uint32 Test_Steps = 0;
+
+/* Simulated ISR: changes the direction of PF2 between two instructions of the driver */
+static void Test_DirectionIsr(void)
+{
+    Test_Steps++;
+    if(Test_Steps == Test_IsrStep)
+    {
+        Port_SetPinDirection(Test_PinId(PORT_F, PIN_2), PORT_PIN_OUT);
+    }
+}
+
+/* PF1 (LED1) and PF4 (SW1) have a locked direction, the drifted pins are restored from the shadow */
+static void Test_Refresh(void)
+{
+    uint8 drift[PORT_NUMBER_OF_PORTS];
+
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET)) & 0x12U) == 0x02U);
+
+    /* Nothing drifted: one GPIODIR load per port with locked pins and no store */
+    Sim_StartLog();
+    Port_RefreshPortDirection();
+    SIM_CHECK((Sim_StopLog() == 1U) && (Sim_LogWrites() == 0U));
+
+    /* PF1 turned into an input and PF4 into an output */
+    Sim_WriteReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET), 0x10U);
+    Port_RefreshPortDirection();
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET)) & 0x12U) == 0x02U);
+    Port_GetDirectionDrift(drift);
+    SIM_CHECK((drift[PORT_F] == 0x12U) && (drift[PORT_A] == 0U));
+
+    /* The locked pins can't be changed by the APIs */
+    Port_SetPinDirection(Test_PinId(PORT_F, PIN_1), PORT_PIN_IN);
+    SIM_CHECK(Det_LastErrorId == PORT_E_DIRECTION_UNCHANGEABLE);
+    Port_SetPortDirectionMask(PORT_F, 0x06U, PORT_PIN_OUT);
+    SIM_CHECK(Det_LastErrorId == PORT_E_DIRECTION_UNCHANGEABLE);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET)) & 0x12U) == 0x02U);
+
+    Det_LastErrorId = 0;
+    Port_GetDirectionDrift(NULL_PTR);
+    SIM_CHECK(Det_LastErrorId == PORT_E_PARAM_POINTER);
+}
+
+/* An ISR changing the direction of PF2 at any instruction boundary of the refresh shall not be undone */
+static void Test_Refresh_Interleaving(void)
+{
+    uint32 fired = 0;
+
+    Sim_SetStepHook(Test_DirectionIsr);
+    for(Test_IsrStep = 1; ; Test_IsrStep++)
+    {
+        Port_SetPinDirection(Test_PinId(PORT_F, PIN_2), PORT_PIN_IN);
+        Sim_WriteReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET), Sim_ReadReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET)) & ~0x02U);
+
+        Test_Steps = 0;
+        Sim_StartCount();
+        Port_RefreshPortDirection();
+        (void)Sim_StopCount();
+        if(Test_Steps < Test_IsrStep)
+        {
+            /* The call ended before this boundary */
+            break;
+        }
+        fired++;
+
+        /* PF1 restored and PF2 keeps the direction set by the ISR */
+        SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DIR_REG_OFFSET)) & 0x06U) == 0x06U);
+    }
+    Sim_SetStepHook(NULL_PTR);
+    SIM_CHECK(fired > 20U);
+}
+
+/* The direction permissions follow the active configuration set (the nibble bus is locked in SLEEP) */
+static void Test_SwitchConfigSet(void)
+{
+    Port_PinType pb4 = Test_PinId(PORT_B, PIN_4);
+
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_PULL_DOWN_REG_OFFSET)) & 0xF0U) == 0xF0U);
+
+    Det_LastErrorId = 0;
+    Port_SetPinDirection(pb4, PORT_PIN_OUT);
+    SIM_CHECK(Det_LastErrorId == PORT_E_DIRECTION_UNCHANGEABLE);
+    Det_LastErrorId = 0;
+    Port_SetPortDirectionMask(PORT_B, 0x10U, PORT_PIN_OUT);
+    SIM_CHECK(Det_LastErrorId == PORT_E_DIRECTION_UNCHANGEABLE);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0U);
+
+    /* The drifted nibble bus is restored while sleeping */
+    Sim_WriteReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET), 0x20U);
+    Port_RefreshPortDirection();
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0U);
+
+    /* Back to the base set: the nibble bus is an output with a changeable direction again */
+    Port_SwitchConfigSet(0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xF0U);
+    Det_LastErrorId = 0;
+    Port_SetPinDirection(pb4, PORT_PIN_IN);
+    SIM_CHECK((Det_LastErrorId == 0U) && ((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xE0U));
+    Port_SetPinDirection(pb4, PORT_PIN_OUT);
+    SIM_CHECK((Det_LastErrorId == 0U) && ((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xF0U));
+}
+
+#if (PORT_APPLY_CONFIG_API == STD_ON)
+/* Port_ApplyConfig moves from the active images (here the SLEEP set), the configuration sets then stay unavailable */
+static void Test_ApplyConfig(void)
+{
+    Port_ConfigType changed = Port_Configuration;
+    Port_PinType pb4 = Test_PinId(PORT_B, PIN_4);
+    Port_PinType pb5 = Test_PinId(PORT_B, PIN_5);
+
+    changed.Images = NULL_PTR;
+    changed.Pin[pb4].direction = PORT_PIN_IN;
+    changed.Pin[pb5].initial_value = PORT_PIN_LEVEL_HIGH;
+
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+
+    /* Only the active configuration can be the old one */
+    Det_LastErrorId = 0;
+    Port_ApplyConfig(&changed, &Port_Configuration);
+    SIM_CHECK(Det_LastErrorId == PORT_E_PARAM_CONFIG);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_PULL_DOWN_REG_OFFSET)) & 0xF0U) == 0xF0U);
+
+    Det_LastErrorId = 0;
+    Port_ApplyConfig(&Port_Configuration, &changed);
+    SIM_CHECK(Det_LastErrorId == 0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xE0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_PULL_DOWN_REG_OFFSET)) & 0xF0U) == 0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DATA_REG_OFFSET)) & 0xF0U) == 0x20U);
+
+    /* The SLEEP set belongs to Port_Configuration, it would bring the replaced pins configuration back */
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+    SIM_CHECK(Det_LastErrorId == PORT_E_PARAM_CONFIG);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xE0U);
+
+    /* Available again once Port_Configuration is applied back */
+    Det_LastErrorId = 0;
+    Port_ApplyConfig(&changed, &Port_Configuration);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xF0U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DATA_REG_OFFSET)) & 0xF0U) == 0U);
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+    SIM_CHECK((Det_LastErrorId == 0U) && ((Sim_ReadReg(TEST_REG(PORT_B, PORT_PULL_DOWN_REG_OFFSET)) & 0xF0U) == 0xF0U));
+    Port_SwitchConfigSet(0U);
+}
+#endif
+
+#endif
+
+/* Simulated resets: Port_Init runs again with the RAM and the registers kept (warm reset),
+ * it shall only skip the reprogramming when the registers hold the configuration it applies */
+static void Test_WarmReset(void)
+{
+    Port_ConfigType changed = Port_Configuration;
+    Port_PinType pb4 = Test_PinId(PORT_B, PIN_4);
+    Sim_CostType cost;
+
+    /* Power-on reset: cold boot */
+    Sim_PowerOnReset();
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK(cost.Stores > TEST_WARM_INIT_STORES);
+
+    /* Warm reset: nothing written and the output values are kept */
+    Sim_WriteReg(TEST_REG(PORT_B, PORT_DATA_REG_OFFSET), 0x50U);
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK((cost.Stores == TEST_WARM_INIT_STORES) && (Sim_ReadReg(TEST_REG(PORT_B, PORT_DATA_REG_OFFSET)) == 0x50U));
+
+    /* A corrupted register is reprogrammed */
+    Sim_WriteReg(TEST_REG(PORT_F, PORT_PULL_UP_REG_OFFSET), 0U);
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK((cost.Stores > TEST_WARM_INIT_STORES) && ((Sim_ReadReg(TEST_REG(PORT_F, PORT_PULL_UP_REG_OFFSET)) & 0x10U) == 0x10U));
+
+#if (PORT_SWITCH_CONFIG_SET_API == STD_ON)
+    /* Reset while the SLEEP set is applied: Port_Init reprograms the base configuration */
+    Port_SwitchConfigSet(PortConf_SLEEP_CONFIG_SET_ID);
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK((cost.Stores > TEST_WARM_INIT_STORES) && ((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xF0U));
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK(cost.Stores == TEST_WARM_INIT_STORES);
+#endif
+
+#if (PORT_APPLY_CONFIG_API == STD_ON)
+    /* Reset after Port_ApplyConfig: the new configuration is kept without any store */
+    changed.Images = NULL_PTR;
+    changed.Pin[pb4].direction = PORT_PIN_IN;
+    Port_ApplyConfig(&Port_Configuration, &changed);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xE0U);
+    SIM_MEASURE(cost, Port_Init(&changed));
+    SIM_CHECK(cost.Stores == TEST_WARM_INIT_STORES);
+
+    /* And the configuration it replaced is reprogrammed */
+    SIM_MEASURE(cost, Port_Init(&Port_Configuration));
+    SIM_CHECK((cost.Stores > TEST_WARM_INIT_STORES) && ((Sim_ReadReg(TEST_REG(PORT_B, PORT_DIR_REG_OFFSET)) & 0xF0U) == 0xF0U));
+#endif
+}
+
+/* The slew rate control of a pin is only set with the 8 mA drive, with or without DET */
+static void Test_SetPinDrive(void)
+{
+    Port_PinType pf1 = Test_PinId(PORT_F, PIN_1);
+
+    Port_SetPinDrive(pf1, PORT_PIN_DRIVE_8MA, TRUE, FALSE);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DRIVE_8MA_REG_OFFSET)) & 0x02U) == 0x02U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_SLEW_RATE_REG_OFFSET)) & 0x02U) == 0x02U);
+
+    /* Slew rate requested with the 2 mA drive */
+    Det_LastErrorId = 0;
+    Port_SetPinDrive(pf1, PORT_PIN_DRIVE_2MA, TRUE, FALSE);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    SIM_CHECK(Det_LastErrorId == PORT_E_PARAM_INVALID_DRIVE);
+#else
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DRIVE_2MA_REG_OFFSET)) & 0x02U) == 0x02U);
+#endif
+    /* The slew rate control is never left set without the 8 mA drive */
+    SIM_CHECK(((Sim_ReadReg(TEST_REG(PORT_F, PORT_SLEW_RATE_REG_OFFSET)) & 0x02U) == 0U) ||
+              ((Sim_ReadReg(TEST_REG(PORT_F, PORT_DRIVE_8MA_REG_OFFSET)) & 0x02U) == 0x02U));
+
+    Port_SetPinDrive(pf1, PORT_PIN_DRIVE_2MA, FALSE, FALSE);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_DRIVE_2MA_REG_OFFSET)) & 0x02U) == 0x02U);
+    SIM_CHECK((Sim_ReadReg(TEST_REG(PORT_F, PORT_SLEW_RATE_REG_OFFSET)) & 0x02U) == 0U);
+}
+
+int main(void)
+{
+    Sim_Init();
+    Port_Init(&Port_Configuration);
+    SIM_CHECK(Det_ErrorCount == 0U);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* The tests of the locked pins rely on the DET checks */
+    Test_Refresh();
+    Test_Refresh_Interleaving();
+    Test_SwitchConfigSet();
+#if (PORT_APPLY_CONFIG_API == STD_ON)
+    Test_ApplyConfig();
+#endif
+#endif
+    Test_SetPinDrive();
+#if (PORT_WARM_BOOT == STD_ON)
+    Test_WarmReset();
+#endif
+
+    printf("Port_Test: %s\n", (Sim_Failures == 0U) ? "PASS" : "FAIL");
+    return (Sim_Failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,514 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Sim_Regs.c
+ *
+ * Description: Host register model used to run the drivers on a Linux x86-64 host
+ *              at the real TM4C123GH6PM register addresses (see Sim_Regs.h).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "Sim_Regs.h"
+
+/* Modelled register regions */
+#define SIM_PERIPHERAL_BASE            (0x40000000U)
+#define SIM_PERIPHERAL_SIZE            (0x00100000U)
+#define SIM_BIT_BAND_BASE              (0x42000000U)
+#define SIM_BIT_BAND_SIZE              (0x02000000U)
+#define SIM_PRIVATE_BASE               (0xE0000000U)
+#define SIM_PRIVATE_SIZE               (0x00010000U)
+#define SIM_NUMBER_OF_REGIONS          (3U)
+#define SIM_PAGE_SIZE                  (0x1000U)
+
+/* GPIO register offsets with a modelled behaviour */
+#define SIM_GPIO_DATA_ALL              (0x3FCU)
+#define SIM_GPIO_DIR                   (0x400U)
+#define SIM_GPIO_AFSEL                 (0x420U)
+#define SIM_GPIO_DR2R                  (0x500U)
+#define SIM_GPIO_DR4R                  (0x504U)
+#define SIM_GPIO_DR8R                  (0x508U)
+#define SIM_GPIO_PUR                   (0x510U)
+#define SIM_GPIO_PDR                   (0x514U)
+#define SIM_GPIO_DEN                   (0x51CU)
+#define SIM_GPIO_LOCK                  (0x520U)
+#define SIM_GPIO_CR                    (0x524U)
+#define SIM_GPIO_PCTL                  (0x52CU)
+#define SIM_GPIO_UNLOCK_KEY            (0x4C4F434BU)
+
+/* System control and SysTick registers with a modelled behaviour */
+#define SIM_SYSCTL_RCGC2               (0x400FE108U)
+#define SIM_SYSCTL_RCGCGPIO            (0x400FE608U)
+#define SIM_SYSCTL_PRGPIO              (0x400FEA08U)
+#define SIM_SYSTICK_CTRL               (0xE000E010U)
+#define SIM_SYSTICK_RELOAD             (0xE000E014U)
+#define SIM_SYSTICK_CURRENT            (0xE000E018U)
+#define SIM_SYSTICK_ENABLE             (0x00000001U)
+#define SIM_SYSTICK_INTEN              (0x00000002U)
+#define SIM_NVIC_INT_CTRL              (0xE000ED04U)
+#define SIM_NVIC_PENDSTSET             (0x04000000U)
+
+/* Trap flag of the x86-64 RFLAGS register */
+#define SIM_TRAP_FLAG                  (0x100U)
+
+typedef struct
+{
+    uint32 Base;
+    uint32 Size;
+    uint8 * Shadow;     /* Second mapping of the same memory, always accessible by the model */
+} Sim_RegionType;
+
+/* Access trapped by the SIGSEGV handler and completed by the SIGTRAP handler */
+typedef struct
+{
+    boolean Active;
+    boolean Write;
+    uint32 Address;
+    uint32 Old;
+} Sim_PendingType;
+
+Sim_AccessType Sim_Log[SIM_LOG_SIZE];
+uint32 Sim_LogCount = 0;
+uint32 Sim_Failures = 0;
+
+static Sim_RegionType Sim_Regions[SIM_NUMBER_OF_REGIONS] =
+{
+    {SIM_PERIPHERAL_BASE, SIM_PERIPHERAL_SIZE, NULL_PTR},
+    {SIM_BIT_BAND_BASE,   SIM_BIT_BAND_SIZE,   NULL_PTR},
+    {SIM_PRIVATE_BASE,    SIM_PRIVATE_SIZE,    NULL_PTR}
+};
+
+static volatile Sim_PendingType Sim_Pending;
+static volatile boolean Sim_Logging = FALSE;
+static volatile boolean Sim_Counting = FALSE;
+static volatile uint32 Sim_Steps = 0;
+static uint32 Sim_CountOverhead = 0;
+static void (* volatile Sim_StepHook)(void) = NULL_PTR;
+static volatile boolean Sim_InHook = FALSE;
+
+/* GPIO blocks of the APB and the AHB apertures */
+static const uint32 Sim_GpioBlocks[] =
+{
+    0x40004000U, 0x40005000U, 0x40006000U, 0x40007000U, 0x40024000U, 0x40025000U,
+    0x40058000U, 0x40059000U, 0x4005A000U, 0x4005B000U, 0x4005C000U, 0x4005D000U
+};
+
+static uint32 * Sim_Word(uint32 Address)
+{
+    uint32 region;
+
+    for(region = 0; region < SIM_NUMBER_OF_REGIONS; region++)
+    {
+        if((Address >= Sim_Regions[region].Base) && (Address - Sim_Regions[region].Base < Sim_Regions[region].Size))
+        {
+            return (uint32 *)(Sim_Regions[region].Shadow + ((Address - Sim_Regions[region].Base) & ~3U));
+        }
+    }
+    fprintf(stderr, "Sim: access to an unmodelled address 0x%08X\n", (unsigned int)Address);
+    abort();
+}
+
+static boolean Sim_IsGpioBlock(uint32 Base)
+{
+    uint32 block;
+
+    for(block = 0; block < sizeof(Sim_GpioBlocks) / sizeof(Sim_GpioBlocks[0]); block++)
+    {
+        if(Sim_GpioBlocks[block] == Base)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static boolean Sim_IsBitBand(uint32 Address)
+{
+    return (Address >= SIM_BIT_BAND_BASE) && (Address - SIM_BIT_BAND_BASE < SIM_BIT_BAND_SIZE);
+}
+
+/* Value returned by a load from the address, with the register read semantics applied */
+static uint32 Sim_Load(uint32 Address)
+{
+    uint32 base = Address & ~(SIM_PAGE_SIZE - 1U);
+    uint32 offset = Address & (SIM_PAGE_SIZE - 1U);
+    uint32 value;
+
+    if(Sim_IsBitBand(Address))
+    {
+        uint32 target = SIM_PERIPHERAL_BASE + (((Address - SIM_BIT_BAND_BASE) >> 5) & ~3U);
+        uint32 bit = ((Address - SIM_BIT_BAND_BASE) >> 2) & 31U;
+        value = (Sim_Load(target) >> bit) & 1U;
+    }
+    else if(Sim_IsGpioBlock(base) && (offset <= SIM_GPIO_DATA_ALL))
+    {
+        /* GPIODATA: the address bits [9:2] select the pins, the other pins read as 0 */
+        value = *Sim_Word(base + SIM_GPIO_DATA_ALL) & ((offset >> 2) & 0xFFU);
+    }
+    else if(Address == SIM_SYSCTL_PRGPIO)
+    {
+        /* The ports are ready as soon as their clock is enabled */
+        value = (*Sim_Word(SIM_SYSCTL_RCGC2) | *Sim_Word(SIM_SYSCTL_RCGCGPIO)) & 0x3FU;
+    }
+    else
+    {
+        value = *Sim_Word(Address);
+    }
+    return value;
+}
+
+/* Apply the register write semantics once the value is in the model, Old is the value before the write */
+static void Sim_Commit(uint32 Address, uint32 Old)
+{
+    uint32 base = Address & ~(SIM_PAGE_SIZE - 1U);
+    uint32 offset = Address & (SIM_PAGE_SIZE - 1U);
+    uint32 * word = Sim_Word(Address);
+    uint32 value = *word;
+
+    if(Sim_IsBitBand(Address))
+    {
+        uint32 target = SIM_PERIPHERAL_BASE + (((Address - SIM_BIT_BAND_BASE) >> 5) & ~3U);
+        uint32 bit = ((Address - SIM_BIT_BAND_BASE) >> 2) & 31U;
+        uint32 target_value = Sim_Load(target);
+        uint32 target_old = *Sim_Word(target);
+
+        /* The bus does a read-modify-write of the target word */
+        target_value = (value & 1U) ? (target_value | (1U << bit)) : (target_value & ~(1U << bit));
+        *Sim_Word(target) = target_value;
+        Sim_Commit(target, target_old);
+    }
+    else if(Sim_IsGpioBlock(base))
+    {
+        uint32 * cr = Sim_Word(base + SIM_GPIO_CR);
+
+        if(offset <= SIM_GPIO_DATA_ALL)
+        {
+            /* GPIODATA: only the pins selected by the address bits [9:2] are written */
+            uint32 mask = (offset >> 2) & 0xFFU;
+            uint32 data = (offset == SIM_GPIO_DATA_ALL) ? Old : *Sim_Word(base + SIM_GPIO_DATA_ALL);
+            *Sim_Word(base + SIM_GPIO_DATA_ALL) = (data & ~mask) | (value & mask);
+        }
+        else if((offset == SIM_GPIO_DR2R) || (offset == SIM_GPIO_DR4R) || (offset == SIM_GPIO_DR8R))
+        {
+            /* Setting a pin in one drive register clears it in the two others */
+            if(offset != SIM_GPIO_DR2R) { *Sim_Word(base + SIM_GPIO_DR2R) &= ~value; }
+            if(offset != SIM_GPIO_DR4R) { *Sim_Word(base + SIM_GPIO_DR4R) &= ~value; }
+            if(offset != SIM_GPIO_DR8R) { *Sim_Word(base + SIM_GPIO_DR8R) &= ~value; }
+        }
+        else if(offset == SIM_GPIO_LOCK)
+        {
+            *word = (value == SIM_GPIO_UNLOCK_KEY) ? 0U : 1U;
+        }
+        else if(offset == SIM_GPIO_CR)
+        {
+            /* The commit register is only writable while the port is unlocked */
+            *word = (*Sim_Word(base + SIM_GPIO_LOCK) == 0U) ? (value & 0xFFU) : Old;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* AFSEL, PUR, PDR and DEN only change for the committed pins */
+        if((offset == SIM_GPIO_AFSEL) || (offset == SIM_GPIO_PUR) || (offset == SIM_GPIO_PDR) || (offset == SIM_GPIO_DEN))
+        {
+            *word = (Old & ~*cr) | (value & *cr);
+            value = *word;
+        }
+
+        /* A pull-up clears the pull-down of the pin and the other way round */
+        if(offset == SIM_GPIO_PUR) { *Sim_Word(base + SIM_GPIO_PDR) &= ~value; }
+        if(offset == SIM_GPIO_PDR) { *Sim_Word(base + SIM_GPIO_PUR) &= ~value; }
+    }
+    else if(Address == SIM_SYSTICK_CURRENT)
+    {
+        /* Any write clears the SysTick current value */
+        *word = 0U;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+static void Sim_LogAccess(uint32 Address, uint32 Value, boolean Write)
+{
+    if(Sim_Logging && (Sim_LogCount < SIM_LOG_SIZE))
+    {
+        Sim_Log[Sim_LogCount].Address = Address;
+        Sim_Log[Sim_LogCount].Value = Value;
+        Sim_Log[Sim_LogCount].Write = Write;
+        Sim_LogCount++;
+    }
+}
+
+/* A store instruction without a load (MOV to memory), anything else writing memory is a read-modify-write */
+static boolean Sim_IsPureStore(const uint8 * Code)
+{
+    while(((*Code & 0xF0U) == 0x40U) || (*Code == 0x66U) || (*Code == 0x67U))
+    {
+        Code++;
+    }
+    return (*Code == 0x88U) || (*Code == 0x89U) || (*Code == 0xC6U) || (*Code == 0xC7U);
+}
+
+static void Sim_Protect(uint32 Address, int Protection)
+{
+    if(mprotect((void *)(uintptr_t)(Address & ~(SIM_PAGE_SIZE - 1U)), SIM_PAGE_SIZE, Protection) != 0)
+    {
+        perror("Sim: mprotect");
+        abort();
+    }
+}
+
+static void Sim_FaultHandler(int Signal, siginfo_t * Info, void * Context)
+{
+    ucontext_t * context = (ucontext_t *)Context;
+    uint32 address = (uint32)(uintptr_t)Info->si_addr;
+    boolean write = (context->uc_mcontext.gregs[REG_ERR] & 2) ? TRUE : FALSE;
+    uint32 * word;
+
+    (void)Signal;
+    if(((uintptr_t)Info->si_addr > 0xFFFFFFFFU) || Sim_Pending.Active)
+    {
+        /* Not a register access of the driver */
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    word = Sim_Word(address);
+    Sim_Pending.Old = *word;
+
+    /* Present the value the hardware would return, also for the load of a read-modify-write */
+    *word = Sim_Load(address);
+    if((FALSE == write) || (FALSE == Sim_IsPureStore((const uint8 *)context->uc_mcontext.gregs[REG_RIP])))
+    {
+        Sim_LogAccess(address, *word, FALSE);
+    }
+
+    /* Let the instruction access the page and stop right after it */
+    Sim_Pending.Active = TRUE;
+    Sim_Pending.Write = write;
+    Sim_Pending.Address = address;
+    Sim_Protect(address, PROT_READ | PROT_WRITE);
+    context->uc_mcontext.gregs[REG_EFL] |= SIM_TRAP_FLAG;
+}
+
+static void Sim_TrapHandler(int Signal, siginfo_t * Info, void * Context)
+{
+    ucontext_t * context = (ucontext_t *)Context;
+
+    (void)Signal;
+    (void)Info;
+    if(Sim_Pending.Active)
+    {
+        Sim_Protect(Sim_Pending.Address, PROT_NONE);
+        if(Sim_Pending.Write)
+        {
+            Sim_LogAccess(Sim_Pending.Address, *Sim_Word(Sim_Pending.Address), TRUE);
+            Sim_Commit(Sim_Pending.Address, Sim_Pending.Old);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        Sim_Pending.Active = FALSE;
+    }
+
+    if(Sim_Counting && (FALSE == Sim_InHook))
+    {
+        Sim_Steps++;
+        if(Sim_StepHook != NULL_PTR)
+        {
+            /* The hook may call the drivers like an ISR, its own accesses are trapped but not stepped */
+            Sim_InHook = TRUE;
+            Sim_StepHook();
+            Sim_InHook = FALSE;
+        }
+    }
+    else
+    {
+        context->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)SIM_TRAP_FLAG;
+    }
+}
+
+void Sim_Init(void)
+{
+    struct sigaction action;
+    uint32 region;
+
+    for(region = 0; region < SIM_NUMBER_OF_REGIONS; region++)
+    {
+        int fd = memfd_create("Sim_Regs", 0);
+        void * regs;
+
+        if((fd < 0) || (ftruncate(fd, Sim_Regions[region].Size) != 0))
+        {
+            perror("Sim: memfd");
+            exit(1);
+        }
+        regs = mmap((void *)(uintptr_t)Sim_Regions[region].Base, Sim_Regions[region].Size, PROT_NONE,
+                    MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+        Sim_Regions[region].Shadow = mmap(NULL, Sim_Regions[region].Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if((regs != (void *)(uintptr_t)Sim_Regions[region].Base) || (Sim_Regions[region].Shadow == MAP_FAILED))
+        {
+            fprintf(stderr, "Sim: can't map the registers at 0x%08X\n", (unsigned int)Sim_Regions[region].Base);
+            exit(1);
+        }
+        close(fd);
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    action.sa_sigaction = Sim_FaultHandler;
+    sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = Sim_TrapHandler;
+    sigaction(SIGTRAP, &action, NULL);
+
+    Sim_PowerOnReset();
+
+    /* Measure the fixed cost of the counting sequence itself */
+    Sim_StartCount();
+    Sim_CountOverhead = Sim_StopCount();
+}
+
+void Sim_PowerOnReset(void)
+{
+    uint32 block;
+
+    for(block = 0; block < sizeof(Sim_GpioBlocks) / sizeof(Sim_GpioBlocks[0]); block++)
+    {
+        uint32 base = Sim_GpioBlocks[block];
+        boolean port_c = ((base == 0x40006000U) || (base == 0x4005A000U)) ? TRUE : FALSE;
+        boolean port_d = ((base == 0x40007000U) || (base == 0x4005B000U)) ? TRUE : FALSE;
+        boolean port_f = ((base == 0x40025000U) || (base == 0x4005D000U)) ? TRUE : FALSE;
+
+        memset(Sim_Word(base), 0, SIM_PAGE_SIZE);
+        *Sim_Word(base + SIM_GPIO_DR2R) = 0xFFU;
+        *Sim_Word(base + SIM_GPIO_LOCK) = 1U;
+        /* PC0-PC3 (JTAG), PD7 and PF0 (NMI) are locked */
+        *Sim_Word(base + SIM_GPIO_CR) = port_c ? 0xF0U : (port_d ? 0x7FU : (port_f ? 0xFEU : 0xFFU));
+        if(port_c)
+        {
+            /* PC0-PC3 start as JTAG pins */
+            *Sim_Word(base + SIM_GPIO_AFSEL) = 0x0FU;
+            *Sim_Word(base + SIM_GPIO_PUR) = 0x0FU;
+            *Sim_Word(base + SIM_GPIO_DEN) = 0x0FU;
+            *Sim_Word(base + SIM_GPIO_PCTL) = 0x00001111U;
+        }
+    }
+    *Sim_Word(SIM_SYSCTL_RCGC2) = 0U;
+    *Sim_Word(SIM_SYSCTL_RCGCGPIO) = 0U;
+    memset(Sim_Word(SIM_PRIVATE_BASE), 0, SIM_PRIVATE_SIZE);
+}
+
+uint32 Sim_ReadReg(uint32 Address)
+{
+    return Sim_Load(Address);
+}
+
+void Sim_WriteReg(uint32 Address, uint32 Value)
+{
+    uint32 base = Address & ~(SIM_PAGE_SIZE - 1U);
+
+    /* The DATA register is written through its all pins address */
+    if(Sim_IsGpioBlock(base) && ((Address & (SIM_PAGE_SIZE - 1U)) <= SIM_GPIO_DATA_ALL))
+    {
+        Address = base + SIM_GPIO_DATA_ALL;
+    }
+    *Sim_Word(Address) = Value;
+}
+
+uint32 Sim_SysTickAdvance(uint32 Cycles)
+{
+    uint32 reload = *Sim_Word(SIM_SYSTICK_RELOAD) & 0x00FFFFFFU;
+    uint32 current = *Sim_Word(SIM_SYSTICK_CURRENT);
+    uint32 to_wrap;
+
+    if(((*Sim_Word(SIM_SYSTICK_CTRL) & SIM_SYSTICK_ENABLE) == 0U) || (reload == 0U) || (Cycles == 0U))
+    {
+        return Cycles;
+    }
+
+    /* A count of 0 loads the reload value at the next clock, the count reaches 0 after reload + 1 clocks */
+    current = (current == 0U) ? (reload + 1U) : current;
+    to_wrap = (Cycles < current) ? Cycles : current;
+    current -= to_wrap;
+    *Sim_Word(SIM_SYSTICK_CURRENT) = current;
+
+    if((current == 0U) && ((*Sim_Word(SIM_SYSTICK_CTRL) & SIM_SYSTICK_INTEN) != 0U))
+    {
+        /* The count went from 1 to 0: the SysTick interrupt is pending */
+        *Sim_Word(SIM_NVIC_INT_CTRL) |= SIM_NVIC_PENDSTSET;
+    }
+    return to_wrap;
+}
+
+boolean Sim_SysTickPending(void)
+{
+    return ((*Sim_Word(SIM_NVIC_INT_CTRL) & SIM_NVIC_PENDSTSET) != 0U) ? TRUE : FALSE;
+}
+
+void Sim_SysTickAcknowledge(void)
+{
+    *Sim_Word(SIM_NVIC_INT_CTRL) &= ~SIM_NVIC_PENDSTSET;
+}
+
+void Sim_StartLog(void)
+{
+    Sim_LogCount = 0;
+    Sim_Logging = TRUE;
+}
+
+uint32 Sim_StopLog(void)
+{
+    Sim_Logging = FALSE;
+    return Sim_LogCount;
+}
+
+uint32 Sim_LogReads(void)
+{
+    uint32 count = 0;
+    uint32 index;
+
+    for(index = 0; index < Sim_LogCount; index++)
+    {
+        count += (Sim_Log[index].Write == FALSE) ? 1U : 0U;
+    }
+    return count;
+}
+
+uint32 Sim_LogWrites(void)
+{
+    return Sim_LogCount - Sim_LogReads();
+}
+
+__attribute__((noinline)) void Sim_StartCount(void)
+{
+    Sim_Steps = 0;
+    Sim_Counting = TRUE;
+    __asm__ volatile("pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" : : : "memory", "cc");
+}
+
+__attribute__((noinline)) uint32 Sim_StopCount(void)
+{
+    __asm__ volatile("pushfq\n\tandq $-257, (%%rsp)\n\tpopfq" : : : "memory", "cc");
+    Sim_Counting = FALSE;
+    return Sim_Steps - Sim_CountOverhead;
+}
+
+void Sim_SetStepHook(void (*Hook)(void))
+{
+    Sim_StepHook = Hook;
+}
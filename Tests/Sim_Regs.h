@@ -0,0 +1,113 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Sim_Regs.h
+ *
+ * Description: Header file of the host register model used to run the drivers
+ *              on a Linux x86-64 host at the real TM4C123GH6PM register addresses.
+ *
+ *              The peripheral (0x40000000), bit-band alias (0x42000000) and
+ *              private peripheral (0xE0000000) regions are mapped at their real
+ *              addresses without any access right, so every register access of
+ *              the driver traps. The access is logged, the hardware semantics of
+ *              the accessed register are applied (GPIODATA address mask, bit-band
+ *              alias, DRxR mutual clear, commit control, SysTick CURRENT clear)
+ *              and the instruction is single stepped with the trap flag.
+ *              The SysTick counter is advanced by the tests (virtual system clock).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef SIM_REGS_H
+#define SIM_REGS_H
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+/* Maximum number of register accesses kept in the access log */
+#define SIM_LOG_SIZE                   (4096U)
+
+/* Register access recorded in the access log */
+typedef struct
+{
+    uint32 Address;     /* Accessed address (aperture or bit-band alias address as used by the driver) */
+    uint32 Value;       /* Value read, or value written by the driver */
+    boolean Write;      /* TRUE for a store, FALSE for a load */
+} Sim_AccessType;
+
+/* Access log, filled between Sim_StartLog and Sim_StopLog */
+extern Sim_AccessType Sim_Log[SIM_LOG_SIZE];
+extern uint32 Sim_LogCount;
+
+/* Cost of a measured statement */
+typedef struct
+{
+    uint32 Instructions;    /* Executed host instructions */
+    uint32 Loads;           /* Register loads */
+    uint32 Stores;          /* Register stores */
+} Sim_CostType;
+
+/* Measure the host instructions and the register accesses of a statement */
+#define SIM_MEASURE(COST, STATEMENT) \
+    do { \
+        Sim_StartLog(); \
+        Sim_StartCount(); \
+        STATEMENT; \
+        (COST).Instructions = Sim_StopCount(); \
+        (void)Sim_StopLog(); \
+        (COST).Loads = Sim_LogReads(); \
+        (COST).Stores = Sim_LogWrites(); \
+    } while(0)
+
+/* Number of failed checks of a test */
+extern uint32 Sim_Failures;
+
+/* Check a condition of a test, a failure is printed and counted */
+#define SIM_CHECK(CONDITION) \
+    do { \
+        if(!(CONDITION)) \
+        { \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #CONDITION); \
+            Sim_Failures++; \
+        } \
+    } while(0)
+
+/* Map the register regions and install the trap handlers, the registers get their reset values */
+void Sim_Init(void);
+
+/* Put every modelled register back to its reset value (power-on reset) */
+void Sim_PowerOnReset(void);
+
+/* Read a register of the model without any access being logged, the DATA register reads all the pins */
+uint32 Sim_ReadReg(uint32 Address);
+
+/* Write a register of the model without any access being logged and without register semantics */
+void Sim_WriteReg(uint32 Address, uint32 Value);
+
+/* Advance the SysTick counter by up to Cycles clocks of the system clock, stopping at the first wrap.
+ * Returns the clocks advanced, a wrap with the interrupt enabled sets PENDSTSET in the INTCTRL register. */
+uint32 Sim_SysTickAdvance(uint32 Cycles);
+
+/* SysTick interrupt pending (PENDSTSET), and its acknowledge on the entry of the simulated ISR */
+boolean Sim_SysTickPending(void);
+void Sim_SysTickAcknowledge(void);
+
+/* Start and stop the access log, Sim_StopLog returns the number of logged accesses */
+void Sim_StartLog(void);
+uint32 Sim_StopLog(void);
+
+/* Number of loads and stores in the access log */
+uint32 Sim_LogReads(void);
+uint32 Sim_LogWrites(void);
+
+/* Single step the code between Sim_StartCount and Sim_StopCount, Sim_StopCount returns the
+ * number of executed host instructions (the fixed cost of the start/stop sequence is removed) */
+void Sim_StartCount(void);
+uint32 Sim_StopCount(void);
+
+/* Function called at every instruction boundary while counting, used to inject ISR register updates.
+ * The hook may call the drivers (like an ISR would do), its register accesses are modelled and logged. */
+void Sim_SetStepHook(void (*Hook)(void));
+
+#endif /* SIM_REGS_H */
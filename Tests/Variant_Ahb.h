@@ -0,0 +1,26 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Variant_Ahb.h
+ *
+ * Description: Configuration variant of the host tests: Port and Dio use the
+ *              AHB GPIO apertures (forced in front of every source).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef VARIANT_AHB_H
+#define VARIANT_AHB_H
+
+#include "Std_Types.h"
+#include "Dio_Cfg.h"
+#include "Port_Cfg.h"
+
+#undef DIO_AHB_APERTURE
+#define DIO_AHB_APERTURE                    (STD_ON)
+
+#undef PORT_AHB_APERTURE
+#define PORT_AHB_APERTURE                   (STD_ON)
+
+#endif /* VARIANT_AHB_H */
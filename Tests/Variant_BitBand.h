@@ -0,0 +1,22 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Variant_BitBand.h
+ *
+ * Description: Configuration variant of the host tests: Dio channels accessed
+ *              through the bit-band alias (forced in front of every source).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef VARIANT_BIT_BAND_H
+#define VARIANT_BIT_BAND_H
+
+#include "Std_Types.h"
+#include "Dio_Cfg.h"
+
+#undef DIO_BIT_BAND_ACCESS
+#define DIO_BIT_BAND_ACCESS                 (STD_ON)
+
+#endif /* VARIANT_BIT_BAND_H */
@@ -0,0 +1,22 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Variant_NoDet.h
+ *
+ * Description: Configuration variant of the host tests: the Port development
+ *              error detection is disabled (forced in front of every source).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef VARIANT_NODET_H
+#define VARIANT_NODET_H
+
+#include "Std_Types.h"
+#include "Port_Cfg.h"
+
+#undef PORT_DEV_ERROR_DETECT
+#define PORT_DEV_ERROR_DETECT               (STD_OFF)
+
+#endif /* VARIANT_NODET_H */
@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: Tests
+ *
+ * File Name: Variant_Tickless.h
+ *
+ * Description: Configuration variant of the host tests: the Os sleeps with a
+ *              stretched SysTick period (tickless idle) between the task
+ *              releases (forced in front of every source).
+ *
+ * Author: Mohamed Tarek
+ ******************************************************************************/
+
+#ifndef VARIANT_TICKLESS_H
+#define VARIANT_TICKLESS_H
+
+#include "Std_Types.h"
+#include "Os_Cfg.h"
+
+#undef OS_TICKLESS
+#define OS_TICKLESS                         (STD_ON)
+
+#endif /* VARIANT_TICKLESS_H */
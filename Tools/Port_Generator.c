@@ -0,0 +1,888 @@
+ /******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Generator.c
+ *
+ * Description: Host tool generating the Post Build Configuration Source files
+ *              (Port_PBcfg.c and Dio_PBcfg.c) for TM4C123GH6PM Microcontroller
+ *              from a compact pin description file.
+ *
+ *              The per-port register images used by Port_Init are precomputed here,
+ *              and the illegal configurations are rejected at generation time:
+ *              - PC0 --> PC3 are the JTAG pins, they can only be described as JTAG
+ *              - PD7 and PF0 are locked, they shall be described with COMMIT
+ *              - SLEW (slew rate control) is only available with the 8MA drive
+ *
+ *              Extra configuration sets (e.g. for sleep) start with a CONFIGSET <name> line,
+ *              the pins described after it override the base description in that set.
+ *
+ *              Build (host): make -C Tools (generator target), make -C Tools check compares
+ *                            the generated files with the committed ones
+ *              Usage       : Port_Generator Tools/Port_Config.txt <output directory>
+ *
+ * Author: Abdelrahman Adel
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define GEN_NUMBER_OF_PORTS      (6U)
+#define GEN_MAX_PINS             (48U)
+#define GEN_MAX_CHANNELS         (32U)
+#define GEN_MAX_GROUPS           (8U)
+#define GEN_MAX_CONFIG_SETS      (4U)
+#define GEN_MAX_NAME             (32U)
+#define GEN_MAX_LINE             (256U)
+#define GEN_MAX_TOKENS           (12U)
+
+/* Target sizes of the generated tables (Port_ConfigPin is packed in 4 bytes, see Port.h) */
+#define GEN_PIN_CONFIG_SIZE      (4U)
+#define GEN_PORT_IMAGE_SIZE      (60U)
+
+/* Number of pins of each port on TM4C123GH6PM (PORTE has 6 pins and PORTF has 5 pins) */
+static const unsigned int Gen_PortPins[GEN_NUMBER_OF_PORTS] = {8, 8, 8, 8, 6, 5};
+
+/* Pins supporting each mode (DIO, ALT1 --> ALT14, ADC), per port ... same table as the Mode_Pins of Gpio_PortDescriptors in Gpio_Ports.c */
+static const unsigned int Gen_ModeValidPins[GEN_NUMBER_OF_PORTS][16] = {
+    { 0xFF, 0x03, 0x3C, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xFF, 0x03, 0xF0, 0x0C, 0xF0, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30 },
+    { 0xFF, 0xFF, 0x30, 0x00, 0x30, 0x00, 0x70, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xFF, 0xFF, 0x0F, 0x03, 0x47, 0x03, 0xC8, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F },
+    { 0x3F, 0x33, 0x00, 0x30, 0x30, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F },
+    { 0x1F, 0x03, 0x0F, 0x09, 0x14, 0x0F, 0x13, 0x1F, 0x11, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00 }
+};
+
+/* Description: Pin description as read from the description file */
+typedef struct
+{
+    unsigned int port;
+    unsigned int pin;
+    int jtag;
+    int commit;
+    int direction_out;
+    const char * resistor;
+    int level_high;
+    const char * mode;
+    unsigned int mode_value;
+    int direction_change;
+    int mode_change;
+    unsigned int drive_ma;
+    int slew_rate;
+    int open_drain;
+    unsigned int line;  /* Line of the description, for the errors found after parsing */
+}Gen_Pin;
+
+/* Description: Dio channel and channel group descriptions */
+typedef struct
+{
+    char name[GEN_MAX_NAME];
+    unsigned int port;
+    unsigned int pin;
+    unsigned int line;
+}Gen_Channel;
+
+typedef struct
+{
+    char name[GEN_MAX_NAME];
+    unsigned int port;
+    unsigned int mask;
+    unsigned int offset;
+    unsigned int line;
+}Gen_Group;
+
+/* Description: Register images of one port, same fields order as Port_PortImageType */
+typedef struct
+{
+    unsigned long Dir;
+    unsigned long Data;
+    unsigned long Pur;
+    unsigned long Pdr;
+    unsigned long Den;
+    unsigned long Afsel;
+    unsigned long Amsel;
+    unsigned long Pctl;
+    unsigned long Dr2r;
+    unsigned long Dr4r;
+    unsigned long Dr8r;
+    unsigned long Odr;
+    unsigned long Slr;
+    unsigned int Commit;
+    unsigned int Configured;
+    unsigned int Dir_Locked;
+    unsigned int Mode_Locked;
+}Gen_Image;
+
+/* Description: Extra configuration set, its pins start as a copy of the base description */
+typedef struct
+{
+    char name[GEN_MAX_NAME];
+    Gen_Pin Pins[GEN_MAX_PINS];
+    Gen_Image Images[GEN_NUMBER_OF_PORTS];
+}Gen_ConfigSet;
+
+static Gen_Pin     Gen_Pins[GEN_MAX_PINS];
+static Gen_Channel Gen_Channels[GEN_MAX_CHANNELS];
+static Gen_Group   Gen_Groups[GEN_MAX_GROUPS];
+static Gen_Image   Gen_Images[GEN_NUMBER_OF_PORTS];
+static Gen_ConfigSet Gen_ConfigSets[GEN_MAX_CONFIG_SETS];
+static unsigned int Gen_PinsCount     = 0;
+static unsigned int Gen_ChannelsCount = 0;
+static unsigned int Gen_GroupsCount   = 0;
+static unsigned int Gen_ConfigSetsCount = 0;
+
+static const char * Gen_FileName = "";
+static unsigned int Gen_LineNumber = 0;
+
+/*******************************************************************************
+                          Local Functions
+*******************************************************************************/
+
+/* Description: Report a description error with its line number and stop the generation */
+static void Gen_Error(const char * message, const char * token)
+{
+    fprintf(stderr, "%s:%u: error: %s%s%s\n", Gen_FileName, Gen_LineNumber, message,
+            (token != NULL) ? ": " : "", (token != NULL) ? token : "");
+    exit(EXIT_FAILURE);
+}
+
+/* Description: Report an error found after parsing at the line of the described item */
+static void Gen_ErrorAt(unsigned int line, const char * message, const char * token)
+{
+    Gen_LineNumber = line;
+    Gen_Error(message, token);
+}
+
+/* Description: Parse a pin name (PF4) or a port name (PF) */
+static int Gen_ParseName(const char * token, unsigned int * port, unsigned int * pin)
+{
+    if((toupper((unsigned char)token[0]) != 'P') || (toupper((unsigned char)token[1]) < 'A')
+       || (toupper((unsigned char)token[1]) >= (int)('A' + GEN_NUMBER_OF_PORTS)))
+    {
+        return 0;
+    }
+    *port = (unsigned int)(toupper((unsigned char)token[1]) - 'A');
+
+    if(pin == NULL)
+    {
+        return (token[2] == '\0');
+    }
+    if((token[2] < '0') || (token[2] > '7') || (token[3] != '\0'))
+    {
+        return 0;
+    }
+    *pin = (unsigned int)(token[2] - '0');
+    return (*pin < Gen_PortPins[*port]);
+}
+
+/* Description: Parse STD_ON/STD_OFF style flags */
+static int Gen_ParseOnOff(const char * token)
+{
+    if(strcmp(token, "ON") == 0)
+    {
+        return 1;
+    }
+    if(strcmp(token, "OFF") != 0)
+    {
+        Gen_Error("expected ON or OFF", token);
+    }
+    return 0;
+}
+
+/* Description: Parse a pin mode: DIO, ADC, ALT1 --> ALT9 or ALT14 */
+static const char * Gen_ParseMode(const char * token, unsigned int * value)
+{
+    static const char * const Gen_Modes[] = {
+        "DIO", "ALT1", "ALT2", "ALT3", "ALT4", "ALT5", "ALT6", "ALT7", "ALT8", "ALT9",
+        NULL, NULL, NULL, NULL, "ALT14", "ADC"
+    };
+    for(unsigned int mode = 0; mode < (sizeof(Gen_Modes) / sizeof(Gen_Modes[0])); mode++)
+    {
+        if((Gen_Modes[mode] != NULL) && (strcmp(token, Gen_Modes[mode]) == 0))
+        {
+            *value = mode;
+            return Gen_Modes[mode];
+        }
+    }
+    Gen_Error("unknown pin mode", token);
+    return NULL;
+}
+
+/* Description: Find the description of a pin, NULL if the pin is not described */
+static const Gen_Pin * Gen_FindPin(unsigned int port, unsigned int pin)
+{
+    for(unsigned int index = 0; index < Gen_PinsCount; index++)
+    {
+        if((Gen_Pins[index].port == port) && (Gen_Pins[index].pin == pin))
+        {
+            return &Gen_Pins[index];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Description: Parse a pin line:
+ * <pin> JTAG
+ * <pin> <IN/OUT> <OFF/PULL_UP/PULL_DOWN> <LOW/HIGH> <mode> <direction change ON/OFF> <mode change ON/OFF> [flags]
+ * flags (any order): COMMIT, one of 2MA/4MA/8MA (default 2MA), SLEW, OPEN_DRAIN
+ */
+static void Gen_ParsePin(char * tokens[], unsigned int count)
+{
+    Gen_Pin * Pin_Ptr = NULL;
+    unsigned int port = 0;
+    unsigned int pin = 0;
+    int drive_set = 0;
+
+    if(!Gen_ParseName(tokens[0], &port, &pin))
+    {
+        Gen_Error("unknown pin", tokens[0]);
+    }
+    if(Gen_ConfigSetsCount > 0)
+    {
+        /* Pin of an extra configuration set: override the base description of the pin */
+        const Gen_Pin * Base_Ptr = Gen_FindPin(port, pin);
+        if((Base_Ptr == NULL) || Base_Ptr->jtag)
+        {
+            Gen_Error("a configuration set can only override the configured pins of the base description", tokens[0]);
+        }
+        Pin_Ptr = &Gen_ConfigSets[Gen_ConfigSetsCount - 1].Pins[Base_Ptr - Gen_Pins];
+    }
+    else
+    {
+        if(Gen_FindPin(port, pin) != NULL)
+        {
+            Gen_Error("pin described twice", tokens[0]);
+        }
+        if(Gen_PinsCount >= GEN_MAX_PINS)
+        {
+            Gen_Error("too many pins", NULL);
+        }
+        Pin_Ptr = &Gen_Pins[Gen_PinsCount++];
+    }
+
+    memset(Pin_Ptr, 0, sizeof(*Pin_Ptr));
+    Pin_Ptr->port = port;
+    Pin_Ptr->pin  = pin;
+    Pin_Ptr->resistor = "OFF";
+    Pin_Ptr->mode = "DIO";
+    Pin_Ptr->drive_ma = 2;
+    Pin_Ptr->line = Gen_LineNumber;
+
+    if((count == 2) && (strcmp(tokens[1], "JTAG") == 0))
+    {
+        if((port != 2) || (pin > 3))
+        {
+            Gen_Error("only PC0 --> PC3 are JTAG pins", tokens[0]);
+        }
+        Pin_Ptr->jtag = 1;
+        return;
+    }
+    if((port == 2) && (pin <= 3))
+    {
+        Gen_Error("PC0 --> PC3 are reserved for JTAG and shall be described as JTAG", tokens[0]);
+    }
+    if(count < 7)
+    {
+        Gen_Error("expected: <pin> <IN/OUT> <OFF/PULL_UP/PULL_DOWN> <LOW/HIGH> <mode> <ON/OFF> <ON/OFF> [COMMIT] [2MA/4MA/8MA] [SLEW] [OPEN_DRAIN]", tokens[0]);
+    }
+
+    if(strcmp(tokens[1], "OUT") == 0)
+    {
+        Pin_Ptr->direction_out = 1;
+    }
+    else if(strcmp(tokens[1], "IN") != 0)
+    {
+        Gen_Error("expected IN or OUT", tokens[1]);
+    }
+
+    if(strcmp(tokens[2], "PULL_UP") == 0)
+    {
+        Pin_Ptr->resistor = "PULL_UP";
+    }
+    else if(strcmp(tokens[2], "PULL_DOWN") == 0)
+    {
+        Pin_Ptr->resistor = "PULL_DOWN";
+    }
+    else if(strcmp(tokens[2], "OFF") != 0)
+    {
+        Gen_Error("expected OFF, PULL_UP or PULL_DOWN", tokens[2]);
+    }
+
+    if(strcmp(tokens[3], "HIGH") == 0)
+    {
+        Pin_Ptr->level_high = 1;
+    }
+    else if(strcmp(tokens[3], "LOW") != 0)
+    {
+        Gen_Error("expected LOW or HIGH", tokens[3]);
+    }
+
+    Pin_Ptr->mode             = Gen_ParseMode(tokens[4], &Pin_Ptr->mode_value);
+    Pin_Ptr->direction_change = Gen_ParseOnOff(tokens[5]);
+    Pin_Ptr->mode_change      = Gen_ParseOnOff(tokens[6]);
+
+    for(unsigned int index = 7; index < count; index++)
+    {
+        if(strcmp(tokens[index], "COMMIT") == 0)
+        {
+            Pin_Ptr->commit = 1;
+        }
+        else if((strcmp(tokens[index], "2MA") == 0) || (strcmp(tokens[index], "4MA") == 0) || (strcmp(tokens[index], "8MA") == 0))
+        {
+            /* A pin has a single drive strength (DR2R, DR4R and DR8R are exclusive) */
+            if(drive_set)
+            {
+                Gen_Error("conflicting drive strength, only one of 2MA, 4MA or 8MA can be given", tokens[index]);
+            }
+            drive_set = 1;
+            Pin_Ptr->drive_ma = (unsigned int)(tokens[index][0] - '0');
+        }
+        else if(strcmp(tokens[index], "SLEW") == 0)
+        {
+            Pin_Ptr->slew_rate = 1;
+        }
+        else if(strcmp(tokens[index], "OPEN_DRAIN") == 0)
+        {
+            Pin_Ptr->open_drain = 1;
+        }
+        else
+        {
+            Gen_Error("expected COMMIT, 2MA, 4MA, 8MA, SLEW or OPEN_DRAIN", tokens[index]);
+        }
+    }
+
+    /* The slew rate control is only available with the 8 mA drive */
+    if(Pin_Ptr->slew_rate && (Pin_Ptr->drive_ma != 8))
+    {
+        Gen_Error("SLEW is only available with the 8MA drive", tokens[0]);
+    }
+
+    /* PD7 and PF0 are locked after reset, they can only be configured through the commit register */
+    if(((port == 3) && (pin == 7)) || ((port == 5) && (pin == 0)))
+    {
+        if(!Pin_Ptr->commit)
+        {
+            Gen_Error("locked pin described without COMMIT", tokens[0]);
+        }
+    }
+    else if(Pin_Ptr->commit)
+    {
+        Gen_Error("COMMIT is only needed for the locked pins PD7 and PF0", tokens[0]);
+    }
+}
+
+/* Description: Parse a Dio channel line: CHANNEL <name> <pin> */
+static void Gen_ParseChannel(char * tokens[], unsigned int count)
+{
+    Gen_Channel * Channel_Ptr = NULL;
+
+    if(count != 3)
+    {
+        Gen_Error("expected: CHANNEL <name> <pin>", NULL);
+    }
+    if(Gen_ChannelsCount >= GEN_MAX_CHANNELS)
+    {
+        Gen_Error("too many channels", NULL);
+    }
+    Channel_Ptr = &Gen_Channels[Gen_ChannelsCount++];
+    snprintf(Channel_Ptr->name, GEN_MAX_NAME, "%s", tokens[1]);
+    Channel_Ptr->line = Gen_LineNumber;
+    if(!Gen_ParseName(tokens[2], &Channel_Ptr->port, &Channel_Ptr->pin))
+    {
+        Gen_Error("unknown pin", tokens[2]);
+    }
+}
+
+/* Description: Parse a Dio channel group line: GROUP <name> <port> <mask> */
+static void Gen_ParseGroup(char * tokens[], unsigned int count)
+{
+    Gen_Group * Group_Ptr = NULL;
+    char * end = NULL;
+
+    if(count != 4)
+    {
+        Gen_Error("expected: GROUP <name> <port> <mask>", NULL);
+    }
+    if(Gen_GroupsCount >= GEN_MAX_GROUPS)
+    {
+        Gen_Error("too many channel groups", NULL);
+    }
+    Group_Ptr = &Gen_Groups[Gen_GroupsCount++];
+    snprintf(Group_Ptr->name, GEN_MAX_NAME, "%s", tokens[1]);
+    Group_Ptr->line = Gen_LineNumber;
+    if(!Gen_ParseName(tokens[2], &Group_Ptr->port, NULL))
+    {
+        Gen_Error("unknown port", tokens[2]);
+    }
+    Group_Ptr->mask = (unsigned int)strtoul(tokens[3], &end, 0);
+    if((*end != '\0') || (Group_Ptr->mask == 0) || (Group_Ptr->mask > 0xFF))
+    {
+        Gen_Error("invalid group mask", tokens[3]);
+    }
+    for(Group_Ptr->offset = 0; !(Group_Ptr->mask & (1U << Group_Ptr->offset)); Group_Ptr->offset++)
+    {
+        /* Find the position of the group from LSB */
+    }
+    if(((Group_Ptr->mask >> Group_Ptr->offset) & ((Group_Ptr->mask >> Group_Ptr->offset) + 1)) != 0)
+    {
+        Gen_Error("the channels of a group shall be adjoining", tokens[3]);
+    }
+}
+
+/* Description: Parse a configuration set line: CONFIGSET <name> */
+static void Gen_ParseConfigSet(char * tokens[], unsigned int count)
+{
+    Gen_ConfigSet * Set_Ptr = NULL;
+
+    if(count != 2)
+    {
+        Gen_Error("expected: CONFIGSET <name>", NULL);
+    }
+    if(Gen_ConfigSetsCount >= GEN_MAX_CONFIG_SETS)
+    {
+        Gen_Error("too many configuration sets", NULL);
+    }
+    Set_Ptr = &Gen_ConfigSets[Gen_ConfigSetsCount++];
+    snprintf(Set_Ptr->name, GEN_MAX_NAME, "%s", tokens[1]);
+    memcpy(Set_Ptr->Pins, Gen_Pins, sizeof(Gen_Pins));
+}
+
+/* Description: Read the description file */
+static void Gen_ReadDescription(const char * file_name)
+{
+    char line[GEN_MAX_LINE];
+    FILE * file = fopen(file_name, "r");
+
+    Gen_FileName = file_name;
+    if(file == NULL)
+    {
+        perror(file_name);
+        exit(EXIT_FAILURE);
+    }
+
+    while(fgets(line, sizeof(line), file) != NULL)
+    {
+        char * tokens[GEN_MAX_TOKENS];
+        unsigned int count = 0;
+        char * comment = strchr(line, '#');
+
+        Gen_LineNumber++;
+        if(comment != NULL)
+        {
+            *comment = '\0';
+        }
+        for(char * token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n"))
+        {
+            if(count >= GEN_MAX_TOKENS)
+            {
+                Gen_Error("too many fields", NULL);
+            }
+            tokens[count++] = token;
+        }
+
+        if(count == 0)
+        {
+            continue;
+        }
+        else if(strcmp(tokens[0], "CONFIGSET") == 0)
+        {
+            Gen_ParseConfigSet(tokens, count);
+        }
+        else if((strcmp(tokens[0], "CHANNEL") == 0) || (strcmp(tokens[0], "GROUP") == 0))
+        {
+            if(Gen_ConfigSetsCount > 0)
+            {
+                Gen_Error("Dio channels and groups shall be described before the configuration sets", tokens[0]);
+            }
+            if(strcmp(tokens[0], "CHANNEL") == 0)
+            {
+                Gen_ParseChannel(tokens, count);
+            }
+            else
+            {
+                Gen_ParseGroup(tokens, count);
+            }
+        }
+        else
+        {
+            Gen_ParsePin(tokens, count);
+        }
+    }
+    fclose(file);
+    Gen_LineNumber = 0;
+}
+
+/* Description: Cross checks between the Port and the Dio descriptions */
+static void Gen_CheckDescription(void)
+{
+    for(unsigned int set = 0; set <= Gen_ConfigSetsCount; set++)
+    {
+        const Gen_Pin * Pins = (set == 0) ? Gen_Pins : Gen_ConfigSets[set - 1].Pins;
+        for(unsigned int index = 0; index < Gen_PinsCount; index++)
+        {
+            const Gen_Pin * Pin_Ptr = &Pins[index];
+            if(!Pin_Ptr->jtag && !(Gen_ModeValidPins[Pin_Ptr->port][Pin_Ptr->mode_value] & (1U << Pin_Ptr->pin)))
+            {
+                Gen_ErrorAt(Pin_Ptr->line, "pin mode not supported by this pin", Pin_Ptr->mode);
+            }
+        }
+    }
+    for(unsigned int index = 0; index < Gen_ChannelsCount; index++)
+    {
+        const Gen_Pin * Pin_Ptr = Gen_FindPin(Gen_Channels[index].port, Gen_Channels[index].pin);
+        if((Pin_Ptr == NULL) || Pin_Ptr->jtag || (strcmp(Pin_Ptr->mode, "DIO") != 0))
+        {
+            Gen_ErrorAt(Gen_Channels[index].line, "Dio channel on a pin not configured in DIO mode", Gen_Channels[index].name);
+        }
+    }
+    for(unsigned int index = 0; index < Gen_GroupsCount; index++)
+    {
+        for(unsigned int pin = 0; pin < 8; pin++)
+        {
+            if(Gen_Groups[index].mask & (1U << pin))
+            {
+                const Gen_Pin * Pin_Ptr = Gen_FindPin(Gen_Groups[index].port, pin);
+                if((Pin_Ptr == NULL) || Pin_Ptr->jtag || (strcmp(Pin_Ptr->mode, "DIO") != 0))
+                {
+                    Gen_ErrorAt(Gen_Groups[index].line, "Dio channel group on a pin not configured in DIO mode", Gen_Groups[index].name);
+                }
+            }
+        }
+    }
+}
+
+/* Description: Fold the pins description into the register images, the same way as Port_Init */
+static void Gen_FoldImages(const Gen_Pin * Pins, Gen_Image * Images)
+{
+    for(unsigned int index = 0; index < Gen_PinsCount; index++)
+    {
+        const Gen_Pin * Pin_Ptr = &Pins[index];
+        Gen_Image * Image_Ptr = &Images[Pin_Ptr->port];
+        unsigned int Pin_Mask = 1U << Pin_Ptr->pin;
+
+        if(Pin_Ptr->jtag)
+        {
+            continue;
+        }
+        if(Pin_Ptr->commit)
+        {
+            Image_Ptr->Commit |= Pin_Mask;
+        }
+        Image_Ptr->Configured |= Pin_Mask;
+        if(!Pin_Ptr->direction_change)
+        {
+            Image_Ptr->Dir_Locked |= Pin_Mask;
+        }
+        if(!Pin_Ptr->mode_change)
+        {
+            Image_Ptr->Mode_Locked |= Pin_Mask;
+        }
+
+        if(Pin_Ptr->drive_ma == 8)
+        {
+            Image_Ptr->Dr8r |= Pin_Mask;
+            if(Pin_Ptr->slew_rate)
+            {
+                Image_Ptr->Slr |= Pin_Mask;
+            }
+        }
+        else if(Pin_Ptr->drive_ma == 4)
+        {
+            Image_Ptr->Dr4r |= Pin_Mask;
+        }
+        else
+        {
+            Image_Ptr->Dr2r |= Pin_Mask;
+        }
+        if(Pin_Ptr->open_drain)
+        {
+            Image_Ptr->Odr |= Pin_Mask;
+        }
+
+        if(Pin_Ptr->direction_out)
+        {
+            Image_Ptr->Dir |= Pin_Mask;
+            if(Pin_Ptr->level_high)
+            {
+                Image_Ptr->Data |= Pin_Mask;
+            }
+        }
+        else if(strcmp(Pin_Ptr->resistor, "PULL_UP") == 0)
+        {
+            Image_Ptr->Pur |= Pin_Mask;
+        }
+        else if(strcmp(Pin_Ptr->resistor, "PULL_DOWN") == 0)
+        {
+            Image_Ptr->Pdr |= Pin_Mask;
+        }
+
+        if(strcmp(Pin_Ptr->mode, "DIO") == 0)
+        {
+            Image_Ptr->Den |= Pin_Mask;
+        }
+        else if(strcmp(Pin_Ptr->mode, "ADC") == 0)
+        {
+            Image_Ptr->Afsel |= Pin_Mask;
+            Image_Ptr->Amsel |= Pin_Mask;
+        }
+        else
+        {
+            Image_Ptr->Afsel |= Pin_Mask;
+            Image_Ptr->Pctl  |= (unsigned long)(Pin_Ptr->mode_value & 0xF) << (Pin_Ptr->pin * 4);
+            Image_Ptr->Den   |= Pin_Mask;
+        }
+    }
+}
+
+/* Description: Open an output file and write the common file header */
+static FILE * Gen_OpenOutput(const char * directory, const char * module, const char * file_name, const char * author)
+{
+    char path[512];
+    FILE * file = NULL;
+
+    snprintf(path, sizeof(path), "%s/%s", directory, file_name);
+    file = fopen(path, "w");
+    if(file == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(file,
+        " /******************************************************************************\n"
+        " *\n"
+        " * Module: %s\n"
+        " *\n"
+        " * File Name: %s\n"
+        " *\n"
+        " * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - %s Driver\n"
+        " *              Generated by Tools/Port_Generator from the pin description file ... do not edit.\n"
+        " *\n"
+        " * Author: %s\n"
+        " ******************************************************************************/\n"
+        "\n", module, file_name, module, author);
+    return file;
+}
+
+/* Description: Write the version checks of a PBcfg file */
+static void Gen_WriteVersions(FILE * file, const char * prefix, const char * header)
+{
+    fprintf(file,
+        "#include \"%s.h\"\n"
+        "\n"
+        "/*\n"
+        " * Module Version 1.0.0\n"
+        " */\n"
+        "#define %s_PBCFG_SW_MAJOR_VERSION              (1U)\n"
+        "#define %s_PBCFG_SW_MINOR_VERSION              (0U)\n"
+        "#define %s_PBCFG_SW_PATCH_VERSION              (0U)\n"
+        "\n"
+        "/*\n"
+        " * AUTOSAR Version 4.0.3\n"
+        " */\n"
+        "#define %s_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)\n"
+        "#define %s_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)\n"
+        "#define %s_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)\n"
+        "\n"
+        "/* AUTOSAR Version checking between %s_PBcfg.c and %s.h files */\n"
+        "#if ((%s_PBCFG_AR_RELEASE_MAJOR_VERSION != %s_AR_RELEASE_MAJOR_VERSION)\\\n"
+        " ||  (%s_PBCFG_AR_RELEASE_MINOR_VERSION != %s_AR_RELEASE_MINOR_VERSION)\\\n"
+        " ||  (%s_PBCFG_AR_RELEASE_PATCH_VERSION != %s_AR_RELEASE_PATCH_VERSION))\n"
+        "  #error \"The AR version of PBcfg.c does not match the expected version\"\n"
+        "#endif\n"
+        "\n"
+        "/* Software Version checking between %s_PBcfg.c and %s.h files */\n"
+        "#if ((%s_PBCFG_SW_MAJOR_VERSION != %s_SW_MAJOR_VERSION)\\\n"
+        " ||  (%s_PBCFG_SW_MINOR_VERSION != %s_SW_MINOR_VERSION)\\\n"
+        " ||  (%s_PBCFG_SW_PATCH_VERSION != %s_SW_PATCH_VERSION))\n"
+        "  #error \"The SW version of PBcfg.c does not match the expected version\"\n"
+        "#endif\n"
+        "\n",
+        header, prefix, prefix, prefix, prefix, prefix, prefix,
+        header, header, prefix, prefix, prefix, prefix, prefix, prefix,
+        header, header, prefix, prefix, prefix, prefix, prefix, prefix);
+}
+
+/* Description: Write one table of per-port register images */
+static void Gen_WriteImages(FILE * file, const char * name, const Gen_Image * Images)
+{
+    fprintf(file,
+        "STATIC const Port_PortImageType %s[PORT_NUMBER_OF_PORTS] = {\n"
+        "                /*   DIR    ,   DATA   ,   PUR    ,   PDR    ,   DEN    ,  AFSEL   ,  AMSEL   ,   PCTL    ,   DR2R   ,   DR4R   ,   DR8R   ,   ODR    ,   SLR    , COMMIT , CONFIGURED , DIR LOCKED , MODE LOCKED */\n",
+        name);
+    for(unsigned int port = 0; port < GEN_NUMBER_OF_PORTS; port++)
+    {
+        const Gen_Image * Image_Ptr = &Images[port];
+        fprintf(file, "                { 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, 0x%02X , 0x%02X       , 0x%02X       , 0x%02X }%s /* PORT%c */\n",
+                Image_Ptr->Dir, Image_Ptr->Data, Image_Ptr->Pur, Image_Ptr->Pdr, Image_Ptr->Den,
+                Image_Ptr->Afsel, Image_Ptr->Amsel, Image_Ptr->Pctl,
+                Image_Ptr->Dr2r, Image_Ptr->Dr4r, Image_Ptr->Dr8r, Image_Ptr->Odr, Image_Ptr->Slr, Image_Ptr->Commit, Image_Ptr->Configured, Image_Ptr->Dir_Locked, Image_Ptr->Mode_Locked,
+                (port + 1 < GEN_NUMBER_OF_PORTS) ? "," : " ", 'A' + port);
+    }
+    fprintf(file, "};\n\n");
+}
+
+/* Description: Write Port_PBcfg.c */
+static void Gen_WritePort(const char * directory)
+{
+    FILE * file = Gen_OpenOutput(directory, "Port", "Port_PBcfg.c", "Abdelrahman Adel");
+
+    Gen_WriteVersions(file, "PORT", "Port");
+
+    fprintf(file,
+        "/* The number of the described pins shall match the Pre-Compile configuration */\n"
+        "typedef char Port_PinsCountCheck[(PORT_NUMBER_OF_PINS == %uU) ? 1 : -1];\n"
+        "\n", Gen_PinsCount);
+
+    fprintf(file,
+        "/* Register images of each port precomputed from the pins configuration, used by the Port_Init fast path */\n");
+    Gen_WriteImages(file, "Port_ConfigurationImages", Gen_Images);
+
+    for(unsigned int set = 0; set < Gen_ConfigSetsCount; set++)
+    {
+        char name[2 * GEN_MAX_NAME];
+        snprintf(name, sizeof(name), "Port_%s_ConfigSetImages", Gen_ConfigSets[set].name);
+        fprintf(file, "/* Register images of the %s configuration set */\n", Gen_ConfigSets[set].name);
+        Gen_WriteImages(file, name, Gen_ConfigSets[set].Images);
+    }
+
+    fprintf(file,
+        "/* Configuration sets used with Port_SwitchConfigSet API, indexed by the PortConf_xxx_CONFIG_SET_ID */\n"
+        "typedef char Port_ConfigSetsCountCheck[(PORT_NUMBER_OF_CONFIG_SETS == %uU) ? 1 : -1];\n",
+        Gen_ConfigSetsCount + 1);
+    for(unsigned int set = 0; set < Gen_ConfigSetsCount; set++)
+    {
+        fprintf(file, "typedef char Port_%s_Check[(PortConf_%s_CONFIG_SET_ID == %uU) ? 1 : -1];\n",
+                Gen_ConfigSets[set].name, Gen_ConfigSets[set].name, set + 1);
+    }
+    fprintf(file,
+        "const Port_PortImageType * const Port_ConfigSets[PORT_NUMBER_OF_CONFIG_SETS] = {\n"
+        "                Port_ConfigurationImages");
+    for(unsigned int set = 0; set < Gen_ConfigSetsCount; set++)
+    {
+        fprintf(file, ",\n                Port_%s_ConfigSetImages", Gen_ConfigSets[set].name);
+    }
+    fprintf(file, "\n};\n\n");
+
+
+    fprintf(file,
+        "/* PB structure used with Port_Init API */\n"
+        "const Port_ConfigType Port_Configuration = {\n"
+        "              {");
+    for(unsigned int index = 0; index < Gen_PinsCount; index++)
+    {
+        const Gen_Pin * Pin_Ptr = &Gen_Pins[index];
+
+        if((index == 0) || (Gen_Pins[index - 1].port != Pin_Ptr->port))
+        {
+            fprintf(file, "\n                /***********************************Port %c Configuration*************************************/\n",
+                    'A' + Pin_Ptr->port);
+        }
+        fprintf(file, "\t\t{PORT_%c , PIN_%u , %s , %s , %s , PORT_PIN_MODE_%s , %s , %s , PORT_PIN_DRIVE_%uMA , %s , %s}%s%s\n",
+                'A' + Pin_Ptr->port, Pin_Ptr->pin,
+                Pin_Ptr->direction_out ? "PORT_PIN_OUT" : "PORT_PIN_IN",
+                Pin_Ptr->resistor,
+                Pin_Ptr->level_high ? "PORT_PIN_LEVEL_HIGH" : "PORT_PIN_LEVEL_LOW",
+                Pin_Ptr->mode,
+                Pin_Ptr->direction_change ? "STD_ON" : "STD_OFF",
+                Pin_Ptr->mode_change ? "STD_ON" : "STD_OFF",
+                Pin_Ptr->drive_ma,
+                Pin_Ptr->slew_rate ? "STD_ON" : "STD_OFF",
+                Pin_Ptr->open_drain ? "STD_ON" : "STD_OFF",
+                (index + 1 < Gen_PinsCount) ? "," : "",
+                Pin_Ptr->jtag ? " /* JTAG pin ... never configured */" : "");
+    }
+    fprintf(file,
+        "              },\n"
+        "              Port_ConfigurationImages\n"
+        "};\n");
+    fclose(file);
+}
+
+/* Description: Write Dio_PBcfg.c */
+static void Gen_WriteDio(const char * directory)
+{
+    FILE * file = Gen_OpenOutput(directory, "Dio", "Dio_PBcfg.c", "Mohamed Tarek");
+
+    Gen_WriteVersions(file, "DIO", "Dio");
+
+    fprintf(file,
+        "/* The described channels and groups shall match the Pre-Compile configuration in Dio_Cfg.h */\n"
+        "typedef char Dio_ChannelsCountCheck[(DIO_CONFIGURED_CHANNLES == %uU) ? 1 : -1];\n"
+        "typedef char Dio_GroupsCountCheck[(DIO_CONFIGURED_GROUPS == %uU) ? 1 : -1];\n",
+        Gen_ChannelsCount, Gen_GroupsCount);
+    for(unsigned int index = 0; index < Gen_ChannelsCount; index++)
+    {
+        const Gen_Channel * Channel_Ptr = &Gen_Channels[index];
+        fprintf(file,
+            "typedef char Dio_%s_Check[((DioConf_%s_CHANNEL_ID_INDEX == %u) && (DioConf_%s_PORT_NUM == %u)"
+            " && (DioConf_%s_CHANNEL_NUM == %u)) ? 1 : -1];\n",
+            Channel_Ptr->name, Channel_Ptr->name, index, Channel_Ptr->name, Channel_Ptr->port,
+            Channel_Ptr->name, Channel_Ptr->pin);
+    }
+    for(unsigned int index = 0; index < Gen_GroupsCount; index++)
+    {
+        const Gen_Group * Group_Ptr = &Gen_Groups[index];
+        fprintf(file,
+            "typedef char Dio_%s_Check[((DioConf_%s_GROUP_ID_INDEX == %u) && (DioConf_%s_GROUP_PORT_NUM == %u)"
+            " && (DioConf_%s_GROUP_MASK == 0x%02X) && (DioConf_%s_GROUP_OFFSET == %u)) ? 1 : -1];\n",
+            Group_Ptr->name, Group_Ptr->name, index, Group_Ptr->name, Group_Ptr->port,
+            Group_Ptr->name, Group_Ptr->mask, Group_Ptr->name, Group_Ptr->offset);
+    }
+
+    fprintf(file,
+        "\n"
+        "/* PB structure used with Dio_Init API */\n"
+        "const Dio_ConfigType Dio_Configuration = {\n"
+        "                                             {\n");
+    for(unsigned int index = 0; index < Gen_ChannelsCount; index++)
+    {
+        fprintf(file, "                                              {DioConf_%s_PORT_NUM,DioConf_%s_CHANNEL_NUM}%s\n",
+                Gen_Channels[index].name, Gen_Channels[index].name, (index + 1 < Gen_ChannelsCount) ? "," : "");
+    }
+    fprintf(file,
+        "                                             },\n"
+        "                                             {\n");
+    for(unsigned int index = 0; index < Gen_GroupsCount; index++)
+    {
+        fprintf(file, "                                              {DioConf_%s_GROUP_MASK,DioConf_%s_GROUP_OFFSET,DioConf_%s_GROUP_PORT_NUM}%s\n",
+                Gen_Groups[index].name, Gen_Groups[index].name, Gen_Groups[index].name,
+                (index + 1 < Gen_GroupsCount) ? "," : "");
+    }
+    fprintf(file,
+        "                                             }\n"
+        "                                         };\n");
+    fclose(file);
+}
+
+/*******************************************************************************
+                          Main
+*******************************************************************************/
+int main(int argc, char * argv[])
+{
+    if(argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <pin description file> <output directory>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Gen_ReadDescription(argv[1]);
+    Gen_CheckDescription();
+    Gen_FoldImages(Gen_Pins, Gen_Images);
+    for(unsigned int set = 0; set < Gen_ConfigSetsCount; set++)
+    {
+        Gen_FoldImages(Gen_ConfigSets[set].Pins, Gen_ConfigSets[set].Images);
+    }
+    Gen_WritePort(argv[2]);
+    Gen_WriteDio(argv[2]);
+
+    printf("Generated Port_PBcfg.c (%u pins) and Dio_PBcfg.c (%u channels, %u groups) in %s\n",
+           Gen_PinsCount, Gen_ChannelsCount, Gen_GroupsCount, argv[2]);
+    printf("Port configuration size: %u bytes of pins + %u bytes of port images (%u configuration sets)\n",
+           Gen_PinsCount * GEN_PIN_CONFIG_SIZE, (Gen_ConfigSetsCount + 1) * GEN_NUMBER_OF_PORTS * GEN_PORT_IMAGE_SIZE,
+           Gen_ConfigSetsCount + 1);
+    return EXIT_SUCCESS;
+}
@@ -145,6 +145,13 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/*****************************************************************************
+Debug and Data Watchpoint and Trace (DWT) Registers
+*****************************************************************************/
+#define CORE_DEBUG_DEMCR_REG      (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
 /*****************************************************************************
 PLL Registers
 *****************************************************************************/
@@ -202,6 +209,7 @@ NVIC Registers
 #define NVIC_DIS3_REG             (*((volatile uint32 *)0xE000E18C))
 #define NVIC_DIS4_REG             (*((volatile uint32 *)0xE000E190))
 
+#define NVIC_INT_CTRL_REG         (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_PRI1_REG      (*((volatile uint32 *)0xE000ED18))
 #define NVIC_SYSTEM_PRI2_REG      (*((volatile uint32 *)0xE000ED1C))
 #define NVIC_SYSTEM_PRI3_REG      (*((volatile uint32 *)0xE000ED20))